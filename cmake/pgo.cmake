@@ -0,0 +1,134 @@
+# Profile-guided optimisation pipeline, run in script mode from the repository root:
+#
+#   cmake [-DBUILD_DIR=build-pgo] [-DTRAINING=input|generated] [-DTIMEOUT=60] [-DJOBS=8] [-DCXX=g++]
+#         -P cmake/pgo.cmake
+#
+#   1. reference  optimised build with LTO, the point of comparison
+#   2. generate   instrumented build (AOC_PGO=GENERATE)
+#   3. training   every day executable solves both parts of its day-N/input.txt, or of an input made by aoc-generate
+#                 with TRAINING=generated or when the day has no input; a run is stopped after TIMEOUT seconds
+#   4. use        optimised build with LTO from the profiles (AOC_PGO=USE)
+#   5. report     aoc-bench of both optimised builds on every day whose training finished in time, compared side
+#                 by side with aoc-regress
+#
+# Every stage lives in its own directory under BUILD_DIR; the profiles are in BUILD_DIR/profiles.
+
+cmake_minimum_required(VERSION 3.27)
+
+get_filename_component(default_source "${CMAKE_CURRENT_LIST_DIR}/.." ABSOLUTE)
+if (NOT SOURCE_DIR)
+    set(SOURCE_DIR "${default_source}")
+endif ()
+if (NOT BUILD_DIR)
+    set(BUILD_DIR "${SOURCE_DIR}/build-pgo")
+endif ()
+if (NOT TRAINING)
+    set(TRAINING input)
+endif ()
+if (NOT TIMEOUT)
+    set(TIMEOUT 60)
+endif ()
+if (NOT TRAINING MATCHES "^(input|generated)$")
+    message(FATAL_ERROR "TRAINING must be 'input' or 'generated', not '${TRAINING}'")
+endif ()
+
+get_filename_component(BUILD_DIR "${BUILD_DIR}" ABSOLUTE)
+set(profiles "${BUILD_DIR}/profiles")
+set(year "${SOURCE_DIR}/year-2023")
+set(training_dir "${BUILD_DIR}/training")
+
+function(run_checked)
+    execute_process(COMMAND ${ARGN} RESULT_VARIABLE result)
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "failed (${result}): ${ARGN}")
+    endif ()
+endfunction()
+
+function(build_stage name)
+    message(STATUS "pgo: building ${name}")
+    set(arguments -S "${SOURCE_DIR}" -B "${BUILD_DIR}/${name}" -DCMAKE_BUILD_TYPE=Release "-DAOC_PGO_DIR=${profiles}")
+    if (CXX)
+        list(APPEND arguments "-DCMAKE_CXX_COMPILER=${CXX}")
+    endif ()
+    run_checked("${CMAKE_COMMAND}" ${arguments} ${ARGN})
+
+    set(parallel --parallel)
+    if (JOBS)
+        list(APPEND parallel ${JOBS})
+    endif ()
+    run_checked("${CMAKE_COMMAND}" --build "${BUILD_DIR}/${name}" ${parallel})
+endfunction()
+
+# The executable a day directory declares with add_executable(<name> main.cpp).
+function(day_executable day output)
+    file(READ "${year}/day-${day}/CMakeLists.txt" listing)
+    if (NOT listing MATCHES "add_executable\\(([^ )]+) main\\.cpp\\)")
+        message(FATAL_ERROR "no executable found for day ${day}")
+    endif ()
+    set(${output} "${CMAKE_MATCH_1}" PARENT_SCOPE)
+endfunction()
+
+
+build_stage(reference -DAOC_LTO=ON -DAOC_PGO=OFF)
+
+file(REMOVE_RECURSE "${profiles}")
+file(MAKE_DIRECTORY "${profiles}")
+build_stage(generate -DAOC_LTO=OFF -DAOC_PGO=GENERATE)
+
+set(bench_days "")
+foreach (day RANGE 1 25)
+    day_executable(${day} name)
+
+    # the report benchmarks the same inputs, laid out the way aoc-bench --inputs expects
+    set(input "${training_dir}/day-${day}/input.txt")
+    file(MAKE_DIRECTORY "${training_dir}/day-${day}")
+    if (TRAINING STREQUAL "input" AND EXISTS "${year}/day-${day}/input.txt")
+        file(COPY_FILE "${year}/day-${day}/input.txt" "${input}")
+    else ()
+        run_checked("${BUILD_DIR}/generate/year-2023/generator/aoc-generate" ${day} --output "${input}")
+    endif ()
+
+    # every part a day answers teaches the profile something; failures are fine, a hang is stopped
+    set(finished ON)
+    foreach (part 1 2)
+        execute_process(
+            COMMAND "${BUILD_DIR}/generate/year-2023/day-${day}/${name}" "${input}" --part ${part} --no-cache
+            TIMEOUT ${TIMEOUT}
+            RESULT_VARIABLE result
+            OUTPUT_QUIET ERROR_QUIET
+        )
+        if (result MATCHES "timeout")
+            set(finished OFF)
+        endif ()
+    endforeach ()
+
+    if (finished)
+        list(APPEND bench_days ${day})
+        message(STATUS "pgo: trained day ${day} (${name})")
+    else ()
+        message(STATUS "pgo: day ${day} (${name}) timed out, its profile is partial and the report skips it")
+    endif ()
+endforeach ()
+
+# Clang leaves raw profiles that have to be merged, GCC updates its .gcda files in place
+file(GLOB raw_profiles "${profiles}/*.profraw")
+if (raw_profiles)
+    find_program(LLVM_PROFDATA NAMES llvm-profdata REQUIRED)
+    run_checked("${LLVM_PROFDATA}" merge "-output=${profiles}/aoc.profdata" ${raw_profiles})
+endif ()
+
+build_stage(use -DAOC_LTO=ON -DAOC_PGO=USE)
+
+message(STATUS "pgo: timing days ${bench_days}")
+foreach (stage reference use)
+    run_checked(
+        "${BUILD_DIR}/${stage}/year-2023/bench/aoc-bench" ${bench_days} --inputs "${training_dir}"
+        --output "${BUILD_DIR}/${stage}.json"
+    )
+endforeach ()
+
+# the verdicts are informative here, so a slower day does not fail the pipeline
+execute_process(
+    COMMAND "${BUILD_DIR}/use/year-2023/regress/aoc-regress" compare
+        "${BUILD_DIR}/reference.json" "${BUILD_DIR}/use.json"
+)
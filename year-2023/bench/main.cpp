@@ -0,0 +1,306 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <common/io.hpp>
+#include <common/json.hpp>
+#include <common/profiler.hpp>
+#include <common/puzzle.hpp>
+#include <common/stats.hpp>
+#include <puzzles/puzzles.hpp>
+
+
+namespace {
+    struct Options {
+        std::filesystem::path inputs = AOC_INPUTS_DIR;
+        std::optional<std::filesystem::path> input;
+        std::optional<aoc::Part> part;
+        std::size_t warmup = 3;
+        std::size_t repeat = 20;
+        std::optional<std::filesystem::path> output;
+        bool counters = false;
+        std::vector<const aoc::Puzzle*> puzzles;
+    };
+
+    // Timings of one day; each phase holds one sample (in nanoseconds) per measured run.
+    struct Measurement {
+        const aoc::Puzzle* puzzle = nullptr;
+        aoc::Part part = aoc::Part::ONE;
+        std::size_t input_size = 0;
+        std::optional<aoc::Answer> answer;
+        std::string error;
+        std::vector<double> parse;
+        std::vector<double> solve;
+        std::vector<double> total;
+        bool counters = false;  // hardware counters were requested and the host granted them
+        std::vector<core::CounterValues> parse_counters;
+        std::vector<core::CounterValues> solve_counters;
+    };
+
+    void print_usage(std::string_view program) {
+        std::cerr << "usage: " << program
+                  << " [--inputs <dir>] [--input <file>] [--part 1|2] [--warmup <runs>] [--repeat <runs>]"
+                     " [--output <file>] [--counters] [day...]\n"
+                  << "  --inputs  directory holding the day-N/input.txt files (default: " << AOC_INPUTS_DIR << ")\n"
+                  << "  --input   explicit input file, only valid together with a single day\n"
+                  << "  --part    part to solve (default: the part each day answers)\n"
+                  << "  --warmup  unmeasured runs before sampling (default: 3)\n"
+                  << "  --repeat  measured runs (default: 20)\n"
+                  << "  --output  write the JSON report to a file instead of stdout\n"
+                  << "  --counters  add median hardware counters (cycles, instructions, misses) to each phase\n"
+                  << "  day       day numbers to benchmark (default: every registered day that finishes)"
+                  << std::endl;
+    }
+
+    Options parse_options(int argc, char** argv) {
+        Options options;
+
+        const std::vector<std::string_view> args(argv + 1, argv + argc);
+        const auto next_value = [&args](std::size_t& i) {
+            if (i + 1 == args.size()) {
+                throw std::invalid_argument("missing value for '" + std::string(args[i]) + "'");
+            }
+            return args[++i];
+        };
+
+        for (std::size_t i = 0; i != args.size(); i++) {
+            const auto arg = args[i];
+            if (arg == "--inputs") {
+                options.inputs = next_value(i);
+            } else if (arg == "--input") {
+                options.input = next_value(i);
+            } else if (arg == "--part") {
+                auto value = next_value(i);
+                const auto part = io::read<int>(value);
+                if (part != 1 && part != 2) {
+                    throw std::invalid_argument("part must be 1 or 2");
+                }
+                options.part = static_cast<aoc::Part>(part);
+            } else if (arg == "--warmup") {
+                auto value = next_value(i);
+                options.warmup = io::read<std::size_t>(value);
+            } else if (arg == "--repeat") {
+                auto value = next_value(i);
+                options.repeat = io::read<std::size_t>(value);
+                if (options.repeat == 0) {
+                    throw std::invalid_argument("--repeat needs at least one run");
+                }
+            } else if (arg == "--output") {
+                options.output = next_value(i);
+            } else if (arg == "--counters") {
+                options.counters = true;
+            } else {
+                auto value = arg;
+                const auto* puzzle = year2023::find_puzzle(io::read<unsigned>(value));
+                if (puzzle == nullptr) {
+                    throw std::invalid_argument("unknown day '" + std::string(arg) + "'");
+                }
+                options.puzzles.push_back(puzzle);
+            }
+        }
+
+        if (options.input && options.puzzles.size() != 1) {
+            throw std::invalid_argument("--input needs exactly one day");
+        }
+
+        // a day that never finishes would hang the suite, it is only measured when asked for by number
+        if (options.puzzles.empty()) {
+            for (const auto& puzzle : year2023::puzzles()) {
+                if (!puzzle.slow) {
+                    options.puzzles.push_back(&puzzle);
+                }
+            }
+        }
+
+        return options;
+    }
+
+    double elapsed_ns(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to) {
+        return std::chrono::duration<double, std::nano>(to - from).count();
+    }
+
+    Measurement measure(const Options& options, const aoc::Puzzle& puzzle) {
+        Measurement measurement;
+        measurement.puzzle = &puzzle;
+        measurement.part = options.part.value_or(puzzle.part);
+
+        try {
+            const auto path = options.input.value_or(
+                options.inputs / ("day-" + std::to_string(puzzle.day)) / "input.txt"
+            );
+            const io::MappedFile document(path);
+            measurement.input_size = document.size();
+
+            std::optional<core::Profiler> profiler;
+            if (options.counters) {
+                profiler.emplace(true);
+                measurement.counters = profiler->counters_available();
+            }
+
+            // a phase's own record is the one it appends when it opens, whatever phases the solver nests inside it
+            const auto next_record = [&profiler]() { return profiler ? profiler->records().size() : 0; };
+            const auto counters_of = [&profiler](std::size_t record) {
+                return profiler->records()[record].counters.value_or(core::CounterValues{});
+            };
+
+            for (std::size_t run = 0; run != options.warmup + options.repeat; run++) {
+                const auto solution = puzzle.create();
+                const auto parse_record = next_record();
+                const auto start = std::chrono::steady_clock::now();
+                {
+                    const core::ScopedPhase phase("parse");
+                    solution->parse(document.view());
+                }
+                const auto parsed = std::chrono::steady_clock::now();
+                const auto solve_record = next_record();
+                const auto answer = [&] {
+                    const core::ScopedPhase phase("solve");
+                    return solution->solve(measurement.part);
+                }();
+                const auto solved = std::chrono::steady_clock::now();
+
+                if (measurement.answer && *measurement.answer != answer) {
+                    throw std::runtime_error("the answer changed between runs");
+                }
+                measurement.answer = answer;
+
+                if (run >= options.warmup) {
+                    measurement.parse.push_back(elapsed_ns(start, parsed));
+                    measurement.solve.push_back(elapsed_ns(parsed, solved));
+                    measurement.total.push_back(elapsed_ns(start, solved));
+                    if (measurement.counters) {
+                        measurement.parse_counters.push_back(counters_of(parse_record));
+                        measurement.solve_counters.push_back(counters_of(solve_record));
+                    }
+                }
+            }
+        } catch (const std::exception& error) {
+            measurement.answer.reset();
+            measurement.error = error.what();
+        }
+
+        return measurement;
+    }
+
+    // Median of every counter the runs managed to read.
+    void write_counters(core::JsonWriter& json, const std::vector<core::CounterValues>& samples) {
+        const auto write_median = [&json, &samples](std::string_view name, auto field) {
+            std::vector<double> values;
+            for (const auto& sample : samples) {
+                if (const auto& value = sample.*field) {
+                    values.push_back(static_cast<double>(*value));
+                }
+            }
+            if (!values.empty()) {
+                json.field(name, core::summarize(values).median);
+            }
+        };
+
+        json.key("counters").begin_object();
+        write_median("cycles", &core::CounterValues::cycles);
+        write_median("instructions", &core::CounterValues::instructions);
+        write_median("cache_misses", &core::CounterValues::cache_misses);
+        write_median("branch_misses", &core::CounterValues::branch_misses);
+        json.end_object();
+    }
+
+    void write_phase(
+        core::JsonWriter& json, std::string_view name, const std::vector<double>& samples,
+        const std::vector<core::CounterValues>* counters = nullptr
+    ) {
+        const auto summary = core::summarize(samples);
+        json.key(name).begin_object();
+        json.field("samples", summary.count);
+        json.field("min_ns", summary.min);
+        json.field("median_ns", summary.median);
+        json.field("p99_ns", summary.p99);
+        json.field("mean_ns", summary.mean);
+        json.field("stddev_ns", summary.stddev);
+        json.field("max_ns", summary.max);
+        // every measured run in order, for rank tests between reports (see aoc-regress)
+        json.key("samples_ns").begin_array();
+        for (const auto sample : samples) {
+            json.value(sample);
+        }
+        json.end_array();
+        if (counters != nullptr) {
+            write_counters(json, *counters);
+        }
+        json.end_object();
+    }
+
+    void write_report(std::ostream& out, const Options& options, const std::vector<Measurement>& measurements) {
+        core::JsonWriter json(out);
+
+        json.begin_object();
+        json.field("warmup", options.warmup);
+        json.field("repeat", options.repeat);
+        json.field("counters", options.counters);
+        json.key("results").begin_array();
+        for (const auto& measurement : measurements) {
+            json.begin_object();
+            json.field("day", measurement.puzzle->day);
+            json.field("name", measurement.puzzle->name);
+            json.field("part", static_cast<int>(measurement.part));
+            json.field("input_bytes", measurement.input_size);
+            if (measurement.answer) {
+                json.field("answer", *measurement.answer);
+                json.key("phases").begin_object();
+                const bool counters = measurement.counters;
+                write_phase(json, "parse", measurement.parse, counters ? &measurement.parse_counters : nullptr);
+                write_phase(json, "solve", measurement.solve, counters ? &measurement.solve_counters : nullptr);
+                write_phase(json, "total", measurement.total);
+                json.end_object();
+            } else {
+                json.field("error", measurement.error);
+            }
+            json.end_object();
+        }
+        json.end_array();
+        json.end_object();
+    }
+}  // namespace
+
+
+int main(int argc, char** argv) {
+    Options options;
+    try {
+        options = parse_options(argc, argv);
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << std::endl;
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (options.counters && !core::HardwareCounters().available()) {
+        std::cerr << "hardware counters are not available on this system, reporting timings only" << std::endl;
+    }
+
+    std::vector<Measurement> measurements;
+    for (const auto* puzzle : options.puzzles) {
+        std::cerr << "day " << puzzle->day << " (" << puzzle->name << ")..." << std::endl;
+        measurements.emplace_back(measure(options, *puzzle));
+    }
+
+    if (options.output) {
+        std::ofstream out(*options.output);
+        if (!out) {
+            std::cerr << "unable to open " << options.output->string() << std::endl;
+            return EXIT_FAILURE;
+        }
+        write_report(out, options, measurements);
+    } else {
+        write_report(std::cout, options, measurements);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+
+
+namespace core {
+    // Heap activity of the whole process, every thread included. Only counted when aoc-common is built with
+    // AOC_TRACK_ALLOCATIONS=ON, which replaces the global operator new/delete; otherwise everything stays zero.
+    struct AllocationCounters {
+        std::uint64_t count = 0;       // operator new calls
+        std::uint64_t bytes = 0;       // bytes they asked for
+        std::uint64_t live_bytes = 0;  // asked for and not deleted yet
+        std::uint64_t peak_bytes = 0;  // highest live_bytes since the peak was last reset
+    };
+
+    [[nodiscard]] bool allocation_tracking() noexcept;
+
+    [[nodiscard]] AllocationCounters allocation_counters() noexcept;
+
+    // Restarts the peak from the current live size and returns the peak it replaced. A nested measurement hands
+    // that value back to restore_allocation_peak when it ends, so the enclosing one still sees its own maximum.
+    std::uint64_t reset_allocation_peak() noexcept;
+    void restore_allocation_peak(std::uint64_t peak) noexcept;
+}  // namespace core
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <common/puzzle.hpp>
+
+
+namespace aoc {
+    // On-disk store of answers, addressed by the day, part and solver version, a hash of the executable that solved
+    // it and a hash of the input bytes, so solving an input that was seen before costs one hash and one small file
+    // read, and rebuilding a solver after any change retires its old answers. Every entry is its own file;
+    // once there are more than `capacity`, the least recently used ones (by modification time, refreshed on
+    // every hit) are removed. Failing to read or write the cache never fails a solve, it just misses.
+    class ResultCache {
+    public:
+        static constexpr std::size_t DefaultCapacity = 4096;
+
+        struct Key {
+            std::string name;  // entry file name, unique for day, part, version, build and input hash
+            std::uint64_t input_size = 0;
+        };
+
+        explicit ResultCache(
+            std::filesystem::path directory = default_directory(), std::size_t capacity = DefaultCapacity
+        );
+
+        // $AOC_CACHE_DIR, or an "aoc" directory in the user's cache location.
+        [[nodiscard]] static std::filesystem::path default_directory();
+
+        // Nothing when the running executable cannot be read to tell builds apart; the cache is not used then.
+        [[nodiscard]] static std::optional<Key> make_key(const Puzzle& puzzle, Part part, std::string_view input);
+
+        [[nodiscard]] std::optional<Answer> find(const Key& key) const;
+
+        void store(const Key& key, Answer answer) const;
+
+    private:
+        void evict() const;
+
+    private:
+        std::filesystem::path directory_;
+        std::size_t capacity_;
+    };
+}  // namespace aoc
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+
+namespace core {
+    using NodeId = std::uint32_t;
+
+    // Dense ids for names, handed out in order of first appearance. Only views are kept, so the text the names
+    // come from must outlive the interner.
+    class Interner {
+    public:
+        explicit Interner(std::pmr::memory_resource* memory = std::pmr::get_default_resource())
+            : ids_(memory)
+            , names_(memory) {}
+
+        // The id of `name`, a new one when it is seen for the first time.
+        NodeId intern(std::string_view name);
+
+        [[nodiscard]] std::optional<NodeId> find(std::string_view name) const;
+
+        [[nodiscard]] std::string_view name(NodeId id) const noexcept {
+            return names_[id];
+        }
+
+        // Every name, indexed by its id.
+        [[nodiscard]] std::span<const std::string_view> names() const noexcept {
+            return names_;
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept {
+            return names_.size();
+        }
+
+    private:
+        std::pmr::unordered_map<std::string_view, NodeId> ids_;
+        std::pmr::vector<std::string_view> names_;
+    };
+
+    // Immutable directed graph in compressed sparse row form: the successors of every node sit next to each other
+    // in one array, in the order their edges were added, and a second array holds where each node's run starts.
+    // A traversal reads two arrays front to back instead of chasing pointers or hashing names.
+    class Graph {
+    public:
+        struct Edge {
+            NodeId from = 0;
+            NodeId to = 0;
+        };
+
+        explicit Graph(std::pmr::memory_resource* memory = std::pmr::get_default_resource())
+            : offsets_(1, 0, memory)
+            , targets_(memory) {}
+
+        // Every id in `edges` must be below `nodes`.
+        Graph(
+            std::size_t nodes, std::span<const Edge> edges,
+            std::pmr::memory_resource* memory = std::pmr::get_default_resource()
+        );
+
+        [[nodiscard]] std::size_t size() const noexcept {
+            return offsets_.size() - 1;
+        }
+
+        [[nodiscard]] std::size_t edge_count() const noexcept {
+            return targets_.size();
+        }
+
+        [[nodiscard]] std::span<const NodeId> successors(NodeId node) const noexcept {
+            return std::span(targets_).subspan(offsets_[node], offsets_[node + 1] - offsets_[node]);
+        }
+
+        [[nodiscard]] std::size_t degree(NodeId node) const noexcept {
+            return offsets_[node + 1] - offsets_[node];
+        }
+
+    private:
+        std::pmr::vector<std::uint32_t> offsets_;  // size() + 1 entries, the last one is edge_count()
+        std::pmr::vector<NodeId> targets_;
+    };
+
+    // Collects edges between named nodes, for puzzles that list their graph as "name -> names" records.
+    class GraphBuilder {
+    public:
+        explicit GraphBuilder(std::pmr::memory_resource* memory = std::pmr::get_default_resource())
+            : names_(memory)
+            , edges_(memory) {}
+
+        // Adds a node without edges, or returns the id it already has.
+        NodeId add_node(std::string_view name) {
+            return names_.intern(name);
+        }
+
+        void add_edge(std::string_view from, std::string_view to) {
+            const auto source = names_.intern(from);
+            edges_.push_back(Graph::Edge{.from = source, .to = names_.intern(to)});
+        }
+
+        // Both directions, for undirected graphs.
+        void add_link(std::string_view first, std::string_view second) {
+            add_edge(first, second);
+            add_edge(second, first);
+        }
+
+        [[nodiscard]] Graph build(std::pmr::memory_resource* memory = std::pmr::get_default_resource()) const {
+            return Graph(names_.size(), edges_, memory);
+        }
+
+        [[nodiscard]] const Interner& names() const noexcept {
+            return names_;
+        }
+
+        // Lets the names be moved out once the graph is built.
+        [[nodiscard]] Interner& names() noexcept {
+            return names_;
+        }
+
+    private:
+        Interner names_;
+        std::pmr::vector<Graph::Edge> edges_;
+    };
+}  // namespace core
@@ -0,0 +1,226 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+
+namespace core {
+    // Row-major grid in a single allocation, surrounded by a one-cell border of a sentinel value. Cells are
+    // addressed by a flat index; a neighbour is the index plus one of the offsets below, and the border makes
+    // every neighbour of a puzzle cell a valid cell, so walks and scans need no bounds checks.
+    template<typename T>
+    class Grid {
+    public:
+        using Index = std::size_t;
+
+        explicit Grid(std::pmr::memory_resource* memory = std::pmr::get_default_resource())
+            : cells_(memory) {}
+
+        Grid(
+            std::size_t rows, std::size_t cols, T border,
+            std::pmr::memory_resource* memory = std::pmr::get_default_resource()
+        )
+            : rows_(rows)
+            , cols_(cols)
+            , stride_(cols + 2)
+            , cells_((rows + 2) * (cols + 2), border, memory) {}
+
+        [[nodiscard]] std::size_t rows() const noexcept {
+            return rows_;
+        }
+
+        [[nodiscard]] std::size_t cols() const noexcept {
+            return cols_;
+        }
+
+        // Distance between vertically adjacent cells.
+        [[nodiscard]] std::size_t stride() const noexcept {
+            return stride_;
+        }
+
+        // `row` and `col` may be one past either edge, which addresses the border.
+        [[nodiscard]] Index index(std::ptrdiff_t row, std::ptrdiff_t col) const noexcept {
+            return static_cast<Index>(row + 1) * stride_ + static_cast<Index>(col + 1);
+        }
+
+        [[nodiscard]] std::size_t row_of(Index index) const noexcept {
+            return index / stride_ - 1;
+        }
+
+        [[nodiscard]] std::size_t col_of(Index index) const noexcept {
+            return index % stride_ - 1;
+        }
+
+        [[nodiscard]] T& operator[](Index index) noexcept {
+            return cells_[index];
+        }
+
+        [[nodiscard]] const T& operator[](Index index) const noexcept {
+            return cells_[index];
+        }
+
+        [[nodiscard]] T& at(std::ptrdiff_t row, std::ptrdiff_t col) noexcept {
+            return cells_[index(row, col)];
+        }
+
+        [[nodiscard]] const T& at(std::ptrdiff_t row, std::ptrdiff_t col) const noexcept {
+            return cells_[index(row, col)];
+        }
+
+        // The puzzle cells of a row, without its border.
+        [[nodiscard]] std::span<T> row(std::size_t row) noexcept {
+            return std::span(cells_).subspan(index(static_cast<std::ptrdiff_t>(row), 0), cols_);
+        }
+
+        [[nodiscard]] std::span<const T> row(std::size_t row) const noexcept {
+            return std::span(cells_).subspan(index(static_cast<std::ptrdiff_t>(row), 0), cols_);
+        }
+
+        // Up, down, left, right.
+        [[nodiscard]] std::array<std::ptrdiff_t, 4> orthogonal() const noexcept {
+            const auto stride = static_cast<std::ptrdiff_t>(stride_);
+            return {-stride, stride, -1, 1};
+        }
+
+        // The orthogonal offsets followed by the diagonal ones.
+        [[nodiscard]] std::array<std::ptrdiff_t, 8> surrounding() const noexcept {
+            const auto stride = static_cast<std::ptrdiff_t>(stride_);
+            return {-stride, stride, -1, 1, -stride - 1, -stride + 1, stride - 1, stride + 1};
+        }
+
+        // The first puzzle cell holding `value`, in reading order.
+        [[nodiscard]] std::optional<Index> find(const T& value) const noexcept {
+            for (std::size_t r = 0; r != rows_; r++) {
+                const auto cells = row(r);
+                for (std::size_t c = 0; c != cols_; c++) {
+                    if (cells[c] == value) {
+                        return index(static_cast<std::ptrdiff_t>(r), static_cast<std::ptrdiff_t>(c));
+                    }
+                }
+            }
+            return std::nullopt;
+        }
+
+        // Every cell, the border included.
+        [[nodiscard]] std::span<const T> cells() const noexcept {
+            return cells_;
+        }
+
+    private:
+        std::size_t rows_ = 0;
+        std::size_t cols_ = 0;
+        std::size_t stride_ = 2;
+        std::pmr::vector<T> cells_;
+    };
+
+    // Reads a rectangular character grid up to the first empty line; every row must be as wide as the first one.
+    Grid<char> load_grid(
+        std::string_view document, char border, std::pmr::memory_resource* memory = std::pmr::get_default_resource()
+    );
+
+
+    // One bit per cell, for the cells of a single class ("rock", "reachable", ...). Every row is padded to whole
+    // 64-bit words with a clear column on each side and there is a clear row above and below, so shifting a row by
+    // one column or combining it with its neighbours works on entire words and needs no edge cases. Column `c`
+    // is bit `c + 1` of the row.
+    class BitGrid {
+    public:
+        using Word = std::uint64_t;
+        static constexpr std::size_t WordBits = 64;
+
+        explicit BitGrid(std::pmr::memory_resource* memory = std::pmr::get_default_resource())
+            : words_(memory) {}
+
+        BitGrid(
+            std::size_t rows, std::size_t cols, std::pmr::memory_resource* memory = std::pmr::get_default_resource()
+        )
+            : rows_(rows)
+            , cols_(cols)
+            , row_words_((cols + 2 + WordBits - 1) / WordBits)
+            , words_((rows + 2) * row_words_, 0, memory) {}
+
+        // The cells of `grid` that equal `value`.
+        template<typename T>
+        static BitGrid select(
+            const Grid<T>& grid, const T& value, std::pmr::memory_resource* memory = std::pmr::get_default_resource()
+        ) {
+            BitGrid bits(grid.rows(), grid.cols(), memory);
+            for (std::size_t r = 0; r != grid.rows(); r++) {
+                const auto cells = grid.row(r);
+                auto words = bits.row(static_cast<std::ptrdiff_t>(r));
+                for (std::size_t c = 0; c != cells.size(); c++) {
+                    words[(c + 1) / WordBits] |= Word{cells[c] == value} << ((c + 1) % WordBits);
+                }
+            }
+            return bits;
+        }
+
+        [[nodiscard]] std::size_t rows() const noexcept {
+            return rows_;
+        }
+
+        [[nodiscard]] std::size_t cols() const noexcept {
+            return cols_;
+        }
+
+        [[nodiscard]] bool test(std::size_t row, std::size_t col) const noexcept {
+            const auto word = this->row(static_cast<std::ptrdiff_t>(row))[(col + 1) / WordBits];
+            return (word >> ((col + 1) % WordBits) & 1) != 0;
+        }
+
+        void set(std::size_t row, std::size_t col) noexcept {
+            this->row(static_cast<std::ptrdiff_t>(row))[(col + 1) / WordBits] |= Word{1} << ((col + 1) % WordBits);
+        }
+
+        void reset(std::size_t row, std::size_t col) noexcept {
+            this->row(static_cast<std::ptrdiff_t>(row))[(col + 1) / WordBits] &= ~(Word{1} << ((col + 1) % WordBits));
+        }
+
+        // The words of a row, padding columns included; rows() and -1 are the clear border rows.
+        [[nodiscard]] std::span<Word> row(std::ptrdiff_t row) noexcept {
+            return std::span(words_).subspan(static_cast<std::size_t>(row + 1) * row_words_, row_words_);
+        }
+
+        [[nodiscard]] std::span<const Word> row(std::ptrdiff_t row) const noexcept {
+            return std::span(words_).subspan(static_cast<std::size_t>(row + 1) * row_words_, row_words_);
+        }
+
+        // Flips every cell, keeping the padding clear.
+        void invert() noexcept;
+
+        // Keeps the cells that are also set in `other`, which must have the same shape.
+        BitGrid& operator&=(const BitGrid& other) noexcept;
+
+        BitGrid& operator|=(const BitGrid& other) noexcept;
+
+        // Replaces the cells with those of `open` that are orthogonally adjacent to one of `from`: a single step of
+        // a breadth-first walk over every cell at once. All three grids must have the same shape, and `from` must be
+        // another grid than this one.
+        void step(const BitGrid& from, const BitGrid& open) noexcept;
+
+        [[nodiscard]] std::size_t count() const noexcept {
+            std::size_t total = 0;
+            for (const auto word : words_) {
+                total += static_cast<std::size_t>(std::popcount(word));
+            }
+            return total;
+        }
+
+    private:
+        // Clears the padding columns and rows that invert() sets.
+        void clear_padding() noexcept;
+
+    private:
+        std::size_t rows_ = 0;
+        std::size_t cols_ = 0;
+        std::size_t row_words_ = 0;
+        std::pmr::vector<Word> words_;
+    };
+}  // namespace core
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+
+namespace core {
+    // XXH64 of `bytes`: a fast non-cryptographic 64-bit hash, about as quick as reading the memory. Good for
+    // telling inputs apart, not for defending against anyone crafting collisions.
+    [[nodiscard]] std::uint64_t hash_bytes(std::string_view bytes, std::uint64_t seed = 0) noexcept;
+}  // namespace core
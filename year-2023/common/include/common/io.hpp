@@ -0,0 +1,345 @@
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <common/numbers.hpp>
+
+
+namespace io {
+    // Read-only view of a whole file backed by a memory mapping.
+    // Every string_view handed out from it is valid only while the object is alive.
+    class MappedFile {
+    public:
+        explicit MappedFile(const std::filesystem::path& path);
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        [[nodiscard]] std::string_view view() const noexcept {
+            return {data_, size_};
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept {
+            return size_;
+        }
+
+    private:
+        void release() noexcept;
+
+    private:
+        const char* data_ = nullptr;
+        std::size_t size_ = 0;
+#ifdef _WIN32
+        void* file_ = nullptr;
+        void* mapping_ = nullptr;
+#endif
+    };
+
+    // Returns the position of the first '\n' in [begin, end) or `end` if there is none.
+    // Scans with the widest vector unit the library was built for.
+    [[nodiscard]] const char* find_newline(const char* begin, const char* end) noexcept;
+
+    // Strips the '\r' left behind by CRLF line endings.
+    constexpr std::string_view trim_line(std::string_view line) noexcept {
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        return line;
+    }
+
+    // Sequential line cursor over a text buffer: the zero-copy replacement for std::getline.
+    // A trailing newline at the end of the text does not produce an extra empty line.
+    // Usable in constant expressions as well, e.g. to check a day against its embedded test data.
+    class LineReader {
+    public:
+        constexpr explicit LineReader(std::string_view text) noexcept
+            : rest_(text) {}
+
+        constexpr bool next(std::string_view& line) noexcept {
+            if (rest_.empty()) {
+                return false;
+            }
+
+            std::size_t length = 0;
+            if (std::is_constant_evaluated()) {
+                length = std::min(rest_.find('\n'), rest_.size());
+            } else {
+                const auto* const end = find_newline(rest_.data(), rest_.data() + rest_.size());
+                length = static_cast<std::size_t>(end - rest_.data());
+            }
+            line = trim_line(rest_.substr(0, length));
+            rest_.remove_prefix(std::min(length + 1, rest_.size()));
+            return true;
+        }
+
+        [[nodiscard]] constexpr bool eof() const noexcept {
+            return rest_.empty();
+        }
+
+        [[nodiscard]] constexpr std::string_view rest() const noexcept {
+            return rest_;
+        }
+
+    private:
+        std::string_view rest_;
+    };
+
+    // Line cursor over a file or pipe read in fixed-size chunks, for inputs too large to map or to keep in memory.
+    // Memory stays at one chunk (more only for a line longer than that); every line it hands out is valid only
+    // until the next call to `next`.
+    class StreamReader {
+    public:
+        static constexpr std::size_t DefaultChunkSize = std::size_t{1} << 20;
+
+        explicit StreamReader(const std::filesystem::path& path, std::size_t chunk_size = DefaultChunkSize);
+
+        // Reads an already open stream such as stdin, which is left open afterwards.
+        explicit StreamReader(std::FILE* stream, std::size_t chunk_size = DefaultChunkSize);
+
+        ~StreamReader();
+
+        StreamReader(const StreamReader&) = delete;
+        StreamReader& operator=(const StreamReader&) = delete;
+        StreamReader(StreamReader&&) = delete;
+        StreamReader& operator=(StreamReader&&) = delete;
+
+        // Same contract as LineReader::next; throws std::system_error when reading fails.
+        bool next(std::string_view& line);
+
+    private:
+        void refill();
+
+    private:
+        std::FILE* stream_ = nullptr;
+        bool owned_ = false;
+        std::vector<char> buffer_;
+        std::size_t begin_ = 0;  // unread bytes are [begin_, end_)
+        std::size_t end_ = 0;
+        bool eof_ = false;
+    };
+
+    // Range adaptor over LineReader: `for (const auto line : io::lines(text))`.
+    class Lines {
+    public:
+        class iterator {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = std::string_view;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const std::string_view*;
+            using reference = const std::string_view&;
+
+            constexpr iterator() = default;
+
+            constexpr explicit iterator(std::string_view text) noexcept
+                : reader_(text)
+                , done_(false) {
+                ++(*this);
+            }
+
+            constexpr reference operator*() const noexcept {
+                return line_;
+            }
+
+            constexpr iterator& operator++() noexcept {
+                done_ = !reader_.next(line_);
+                return *this;
+            }
+
+            constexpr iterator operator++(int) noexcept {
+                iterator temp = *this;
+                ++(*this);
+                return temp;
+            }
+
+            constexpr bool operator==(const iterator& other) const noexcept {
+                return done_ == other.done_ && (done_ || reader_.rest().data() == other.reader_.rest().data());
+            }
+
+        private:
+            LineReader reader_{std::string_view{}};
+            std::string_view line_;
+            bool done_ = true;
+        };
+
+        constexpr explicit Lines(std::string_view text) noexcept
+            : text_(text) {}
+
+        [[nodiscard]] constexpr iterator begin() const noexcept {
+            return iterator(text_);
+        }
+
+        [[nodiscard]] constexpr iterator end() const noexcept {
+            return {};
+        }
+
+    private:
+        std::string_view text_;
+    };
+
+    constexpr Lines lines(std::string_view text) noexcept {
+        return Lines(text);
+    }
+
+    // Reads what is left of an already open stream such as stdin, for inputs that cannot be mapped.
+    // Throws std::system_error when reading fails.
+    [[nodiscard]] std::string read_stream(std::FILE* stream);
+
+    // Cuts `text` into pieces of about `chunk_size` bytes that each end on a line boundary, for handing whole lines
+    // to different threads. The cut only depends on the text and the size, so per-chunk results are reproducible.
+    [[nodiscard]] std::vector<std::string_view> split_lines(std::string_view text, std::size_t chunk_size);
+
+    constexpr bool is_blank(char symbol) noexcept {
+        return symbol == ' ' || symbol == '\t';
+    }
+
+    // Consumes the next blank-separated token of `line`; returns an empty view when nothing is left.
+    constexpr std::string_view read_token(std::string_view& line) noexcept {
+        std::size_t begin = 0;
+        while (begin != line.size() && is_blank(line[begin])) {
+            begin++;
+        }
+
+        std::size_t end = begin;
+        while (end != line.size() && !is_blank(line[end])) {
+            end++;
+        }
+
+        const auto token = line.substr(begin, end - begin);
+        line.remove_prefix(end);
+        return token;
+    }
+
+    // Field-level counterpart of `std::istream >> value` working on a line view.
+    template<typename T>
+    constexpr T read(std::string_view& line) {
+        const auto token = read_token(line);
+        if constexpr (std::is_same_v<T, std::string_view>) {
+            return token;
+        } else {
+            static_assert(std::is_integral_v<T>, "only integers and raw tokens can be read");
+            return parse_integer<T>(token);
+        }
+    }
+
+    // Reads every blank-separated value left in `line`; integers go through the batch parser.
+    template<typename T>
+    std::vector<T> read_all(std::string_view line) {
+        if constexpr (std::is_integral_v<T>) {
+            return parse_integers<T>(line);
+        } else {
+            std::vector<T> result;
+
+            auto rest = line;
+            while (true) {
+                auto token = read_token(rest);
+                if (token.empty()) {
+                    break;
+                }
+                result.emplace_back(read<T>(token));
+            }
+
+            return result;
+        }
+    }
+
+    constexpr std::string_view read_line(LineReader& input) noexcept {
+        std::string_view line;
+        input.next(line);
+        return line;
+    }
+
+    // Reads a whole line of values, optionally skipping a leading label such as "Time:".
+    template<typename T>
+    std::vector<T> read_sequence(LineReader& input, bool has_prefix = false) {
+        auto line = read_line(input);
+        if (has_prefix) {
+            std::ignore = read_token(line);
+        }
+        return read_all<T>(line);
+    }
+
+    // Single-pass cursor for fixed-format records such as "AAA = (BBB, CCC)", replacing std::regex for them.
+    // Every failure throws std::invalid_argument naming what was expected and where, e.g.
+    //   line 3, column 9: expected ',' in "AAA = (BBB CCC)"
+    class Scanner {
+    public:
+        // `line_number` only feeds the error messages; 0 leaves it out.
+        constexpr explicit Scanner(std::string_view line, std::size_t line_number = 0) noexcept
+            : line_(line)
+            , line_number_(line_number) {}
+
+        constexpr void skip_blanks() noexcept {
+            while (position_ != line_.size() && is_blank(line_[position_])) {
+                position_++;
+            }
+        }
+
+        constexpr void expect(char symbol) {
+            if (position_ == line_.size() || line_[position_] != symbol) {
+                fail(std::string{'\'', symbol, '\''});
+            }
+            position_++;
+        }
+
+        // Letters, digits and underscores, at least one of them.
+        constexpr std::string_view word() {
+            const auto begin = position_;
+            while (position_ != line_.size() && is_word(line_[position_])) {
+                position_++;
+            }
+            if (position_ == begin) {
+                fail("a name");
+            }
+            return line_.substr(begin, position_ - begin);
+        }
+
+        // A run of decimal digits, at least one of them.
+        template<typename T>
+        constexpr T number() {
+            const auto begin = position_;
+            while (position_ != line_.size() && detail::is_digit(line_[position_])) {
+                position_++;
+            }
+            if (position_ == begin) {
+                fail("a number");
+            }
+            return parse_integer<T>(line_.substr(begin, position_ - begin));
+        }
+
+        constexpr void expect_end() {
+            if (position_ != line_.size()) {
+                fail("the end of the line");
+            }
+        }
+
+    private:
+        static constexpr bool is_word(char symbol) noexcept {
+            return detail::is_digit(symbol) || symbol == '_' || (symbol >= 'a' && symbol <= 'z')
+                || (symbol >= 'A' && symbol <= 'Z');
+        }
+
+        [[noreturn]] void fail(std::string_view expected) const;
+
+    private:
+        std::string_view line_;
+        std::size_t line_number_ = 0;
+        std::size_t position_ = 0;
+    };
+}  // namespace io
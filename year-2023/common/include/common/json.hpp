@@ -0,0 +1,101 @@
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace core {
+    // Minimal streaming JSON writer, enough for the reports our tools emit.
+    // Commas and indentation are handled here; callers only describe the structure.
+    class JsonWriter {
+    public:
+        explicit JsonWriter(std::ostream& out)
+            : out_(out) {}
+
+        JsonWriter& begin_object();
+        JsonWriter& end_object();
+
+        JsonWriter& begin_array();
+        JsonWriter& end_array();
+
+        JsonWriter& key(std::string_view name);
+
+        JsonWriter& value(std::string_view text);
+        JsonWriter& value(bool flag);
+        JsonWriter& value(double number);
+
+        template<typename Integer>
+            requires std::integral<Integer> && (!std::same_as<Integer, bool>)
+        JsonWriter& value(Integer number) {
+            prepare_value();
+            out_ << number;
+            return *this;
+        }
+
+        JsonWriter& value(const char* text) {
+            return value(std::string_view(text));
+        }
+
+        // Shorthand for `key(name).value(data)`.
+        template<typename T>
+        JsonWriter& field(std::string_view name, const T& data) {
+            return key(name).value(data);
+        }
+
+    private:
+        void prepare_value();
+        void open(char bracket);
+        void close(char bracket);
+        void write_string(std::string_view text);
+        void new_line();
+
+    private:
+        std::ostream& out_;
+        std::vector<bool> has_items_;  // one entry per open object/array
+        bool after_key_ = false;
+    };
+
+    // Parsed JSON document, the reading side of JsonWriter for tools that compare earlier reports.
+    // Accessors throw std::invalid_argument when the value is not of the requested kind.
+    class JsonValue {
+    public:
+        enum class Kind { NUL, BOOLEAN, NUMBER, STRING, ARRAY, OBJECT };
+
+        // Throws std::invalid_argument naming the offset of the first malformed byte.
+        [[nodiscard]] static JsonValue parse(std::string_view text);
+
+        [[nodiscard]] Kind kind() const noexcept {
+            return kind_;
+        }
+
+        [[nodiscard]] bool as_bool() const;
+        [[nodiscard]] double as_number() const;
+        // The number exactly as written, for counts and answers past 2^53; throws unless it is a plain integer.
+        [[nodiscard]] std::uint64_t as_unsigned() const;
+        [[nodiscard]] const std::string& as_string() const;
+
+        // Elements of an array, or values of an object in document order.
+        [[nodiscard]] const std::vector<JsonValue>& items() const;
+
+        // Member of an object; `find` returns nullptr and `at` throws when there is none.
+        [[nodiscard]] const JsonValue* find(std::string_view key) const;
+        [[nodiscard]] const JsonValue& at(std::string_view key) const;
+
+    private:
+        class Parser;
+
+        void expect(Kind kind) const;
+
+    private:
+        Kind kind_ = Kind::NUL;
+        bool boolean_ = false;
+        double number_ = 0;
+        std::string string_;  // the text of a string, or the literal of a number
+        std::vector<JsonValue> items_;
+        std::vector<std::string> keys_;  // parallel to `items_` for objects
+    };
+}  // namespace core
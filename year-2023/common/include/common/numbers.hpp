@@ -0,0 +1,178 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory_resource>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+
+namespace io {
+    namespace detail {
+        constexpr bool is_digit(char symbol) noexcept {
+            return static_cast<unsigned char>(symbol - '0') < 10;
+        }
+
+        // Value of the last `count` (1..4) digits of the four bytes starting at `block` (SWAR, no branches).
+        inline std::uint32_t parse_four_digits(const char* block, std::size_t count) noexcept {
+            std::uint32_t chunk = 0;
+            std::memcpy(&chunk, block, sizeof(chunk));
+
+            // the bytes in front of the digits become leading zeros
+            chunk &= ~std::uint32_t{0} << (8 * (4 - count));
+            chunk = ((chunk & 0x0F0F0F0F) * 2561) >> 8;
+            return ((chunk & 0x00FF00FF) * 6553601) >> 16;
+        }
+
+        // Same for the last `count` (1..8) digits of eight bytes.
+        inline std::uint32_t parse_eight_digits(const char* block, std::size_t count) noexcept {
+            std::uint64_t chunk = 0;
+            std::memcpy(&chunk, block, sizeof(chunk));
+
+            chunk &= ~std::uint64_t{0} << (8 * (8 - count));
+            chunk = ((chunk & 0x0F0F0F0F0F0F0F0F) * 2561) >> 8;
+            chunk = ((chunk & 0x00FF00FF00FF00FF) * 6553601) >> 16;
+            return static_cast<std::uint32_t>(((chunk & 0x0000FFFF0000FFFF) * 42949672960001) >> 32);
+        }
+
+        // Value of `count` digits that are known to fit the target type; `text_begin` bounds the backward loads.
+        inline std::uint64_t parse_digits(const char* first, std::size_t count, const char* text_begin) noexcept {
+            if constexpr (std::endian::native == std::endian::little) {
+                if (count <= 16) {
+                    const char* last = first + count;
+                    char padded[16];
+                    if (last - text_begin < 16) {
+                        // too close to the start of the text for the 16 byte window: right-align into a copy
+                        std::memset(padded, '0', sizeof(padded));
+                        std::memcpy(padded + sizeof(padded) - count, first, count);
+                        last = padded + sizeof(padded);
+                    }
+
+                    if (count <= 8) {
+                        return parse_eight_digits(last - 8, count);
+                    }
+                    return std::uint64_t{parse_eight_digits(last - 16, count - 8)} * 100'000'000 +
+                           parse_eight_digits(last - 8, 8);
+                }
+            }
+
+            std::uint64_t value = 0;
+            for (std::size_t i = 0; i != count; i++) {
+                value = value * 10 + static_cast<std::uint64_t>(first[i] - '0');
+            }
+            return value;
+        }
+
+        template<typename T>
+        T convert_long(const char* first, const char* last, const char* text_begin) {
+            const bool negative = std::is_signed_v<T> && first != last && *first == '-';
+            const char* digits = first + (negative ? 1 : 0);
+            const auto count = static_cast<std::size_t>(last - digits);
+
+            if (count == 0 || count > static_cast<std::size_t>(std::numeric_limits<T>::digits10)) {
+                T value{};
+                const auto [ptr, ec] = std::from_chars(first, last, value);
+                if (count == 0 || ec != std::errc{} || ptr != last) {
+                    throw std::invalid_argument("Invalid conversion to integer.");
+                }
+                return value;
+            }
+
+            const auto value = static_cast<T>(parse_digits(digits, count, text_begin));
+            return negative ? static_cast<T>(-value) : value;
+        }
+
+        // Converts [first, last) holding digits preceded by an optional '-'; `text_begin` is the start of the
+        // enclosing buffer. Puzzle numbers are short, so up to eight digits take a single SWAR step; longer ones
+        // (and anything near the start of the buffer) go the general way, std::from_chars when range checks matter.
+        template<typename T>
+        T convert(const char* first, const char* last, const char* text_begin) {
+            if constexpr (std::endian::native == std::endian::little) {
+                constexpr auto ShortLength = std::min<std::size_t>(8, std::numeric_limits<T>::digits10);
+
+                const auto count = static_cast<std::size_t>(last - first);
+                if (count - 1 < ShortLength && last - text_begin >= 8 && (std::is_unsigned_v<T> || *first != '-')) {
+                    return static_cast<T>(
+                        count <= 4 ? parse_four_digits(last - 4, count) : parse_eight_digits(last - 8, count)
+                    );
+                }
+            }
+            return convert_long<T>(first, last, text_begin);
+        }
+    }  // namespace detail
+
+    // Converts a whole token of decimal digits (with a leading '-' for signed types); throws on anything else.
+    // In constant expressions it falls back to plain digit accumulation without range checks.
+    template<typename T>
+    constexpr T parse_integer(std::string_view token) {
+        static_assert(std::is_integral_v<T>, "only integers can be parsed");
+
+        const bool negative = std::is_signed_v<T> && !token.empty() && token.front() == '-';
+        for (std::size_t i = negative ? 1 : 0; i != token.size(); i++) {
+            if (!detail::is_digit(token[i])) {
+                throw std::invalid_argument("Invalid conversion to integer.");
+            }
+        }
+
+        if (std::is_constant_evaluated()) {
+            if (token.size() == (negative ? 1 : 0)) {
+                throw std::invalid_argument("Invalid conversion to integer.");
+            }
+
+            T value = 0;
+            for (std::size_t i = negative ? 1 : 0; i != token.size(); i++) {
+                value = static_cast<T>(value * 10 + (token[i] - '0'));
+            }
+            return negative ? static_cast<T>(-value) : value;
+        }
+        return detail::convert<T>(token.data(), token.data() + token.size(), token.data());
+    }
+
+    // Batch parser for a line of blank-separated decimals: classifies the line a vector register at a time and
+    // converts every digit run without going back to the characters one by one.
+    // Appends to `out` and returns how many values were added; throws on any token that is not a number.
+    // Both the default and the std::pmr allocator are supported.
+    template<typename T, typename Allocator>
+    std::size_t parse_integers(std::string_view line, std::vector<T, Allocator>& out);
+
+    // Fills `out` from the front and returns the number of values written; throws if the line holds more.
+    template<typename T>
+    std::size_t parse_integers(std::string_view line, std::span<T> out);
+
+    template<typename T>
+    std::vector<T> parse_integers(std::string_view line) {
+        std::vector<T> values;
+        parse_integers(line, values);
+        return values;
+    }
+
+#define AOC_DECLARE_PARSE_INTEGERS(T)                                                                \
+    extern template std::size_t parse_integers(std::string_view line, std::vector<T>& out);      \
+    extern template std::size_t parse_integers(std::string_view line, std::pmr::vector<T>& out); \
+    extern template std::size_t parse_integers<T>(std::string_view line, std::span<T> out);
+
+    AOC_DECLARE_PARSE_INTEGERS(int)
+    AOC_DECLARE_PARSE_INTEGERS(unsigned)
+    AOC_DECLARE_PARSE_INTEGERS(long)
+    AOC_DECLARE_PARSE_INTEGERS(unsigned long)
+    AOC_DECLARE_PARSE_INTEGERS(long long)
+    AOC_DECLARE_PARSE_INTEGERS(unsigned long long)
+
+#undef AOC_DECLARE_PARSE_INTEGERS
+
+    // Offset of the first ASCII digit in `text`, or npos. Compares a whole vector register of bytes at a time (32
+    // with AVX2, 16 with SSE2), so a line is usually settled by its first block.
+    std::size_t find_first_digit(std::string_view text) noexcept;
+
+    // Offset of the last ASCII digit in `text`, or npos; the blocks are read from the end of the text.
+    std::size_t find_last_digit(std::string_view text) noexcept;
+}  // namespace io
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <common/io.hpp>
+
+
+namespace core {
+    // Bytes of input per task: big enough that scheduling is noise, small enough to balance uneven lines.
+    inline constexpr std::size_t LineChunkSize = std::size_t{1} << 20;
+
+    namespace detail {
+        // Runs task(0) ... task(count - 1) on a pool shared by every call when there is more than one task, or inline
+        // on a thread that is already a pool worker; rethrows the first exception a task threw.
+        void run_chunks(std::size_t count, const std::function<void(std::size_t)>& task);
+    }  // namespace detail
+
+    // Calls `map` on every non-empty line of `text` and folds the results with `reduce`, in parallel over
+    // line-aligned chunks. Chunk results are combined in input order, so the answer does not depend on the number
+    // of threads even when `reduce` is only associative.
+    template<typename T, typename Map, typename Reduce>
+    T map_reduce_lines(std::string_view text, T identity, Map map, Reduce reduce) {
+        const auto chunks = io::split_lines(text, LineChunkSize);
+
+        std::vector<T> partials(chunks.size(), identity);
+        detail::run_chunks(chunks.size(), [&](std::size_t index) {
+            auto partial = identity;
+            for (const auto line : io::lines(chunks[index])) {
+                if (!line.empty()) {
+                    partial = reduce(std::move(partial), map(line));
+                }
+            }
+            partials[index] = std::move(partial);
+        });
+
+        for (auto& partial : partials) {
+            identity = reduce(std::move(identity), std::move(partial));
+        }
+        return identity;
+    }
+
+    // Calls `map` on every non-empty line of `text` in parallel and returns the results in line order. The final
+    // vector is filled on the calling thread, so `allocator` may sit on a resource that is not thread-safe.
+    template<
+        typename Map, typename Result = std::invoke_result_t<Map&, std::string_view>,
+        typename Allocator = std::allocator<Result>>
+    std::vector<Result, Allocator> map_lines(std::string_view text, Map map, const Allocator& allocator = Allocator()) {
+        const auto chunks = io::split_lines(text, LineChunkSize);
+
+        std::vector<std::vector<Result>> parts(chunks.size());
+        detail::run_chunks(chunks.size(), [&](std::size_t index) {
+            for (const auto line : io::lines(chunks[index])) {
+                if (!line.empty()) {
+                    parts[index].push_back(map(line));
+                }
+            }
+        });
+
+        std::size_t total = 0;
+        for (const auto& part : parts) {
+            total += part.size();
+        }
+
+        std::vector<Result, Allocator> results(allocator);
+        results.reserve(total);
+        for (auto& part : parts) {
+            std::move(part.begin(), part.end(), std::back_inserter(results));
+        }
+        return results;
+    }
+}  // namespace core
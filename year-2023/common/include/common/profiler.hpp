@@ -0,0 +1,135 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <common/allocations.hpp>
+#include <common/json.hpp>
+
+
+namespace core {
+    // Hardware events sampled around every phase; a missing value means the host would not count that event.
+    struct CounterValues {
+        std::optional<std::uint64_t> cycles;
+        std::optional<std::uint64_t> instructions;
+        std::optional<std::uint64_t> cache_misses;
+        std::optional<std::uint64_t> branch_misses;
+
+        [[nodiscard]] CounterValues operator-(const CounterValues& other) const noexcept;
+    };
+
+    // A perf_event_open group counting the calling thread in user space. Opening never throws: on other systems,
+    // or when the kernel refuses access (see /proc/sys/kernel/perf_event_paranoid), it is simply unavailable.
+    class HardwareCounters {
+    public:
+        HardwareCounters() noexcept;
+        ~HardwareCounters();
+
+        HardwareCounters(const HardwareCounters&) = delete;
+        HardwareCounters& operator=(const HardwareCounters&) = delete;
+        HardwareCounters(HardwareCounters&&) = delete;
+        HardwareCounters& operator=(HardwareCounters&&) = delete;
+
+        [[nodiscard]] bool available() const noexcept {
+            return leader_ != -1;
+        }
+
+        // Totals since the group was opened.
+        [[nodiscard]] CounterValues read() const noexcept;
+
+    private:
+        static constexpr std::size_t EventCount = 4;
+
+        int leader_ = -1;
+        std::array<int, EventCount> descriptors_{-1, -1, -1, -1};  // one per CounterValues field, -1 if not counted
+    };
+
+    // Heap use of a phase (see core::allocation_counters), including what other threads allocated meanwhile.
+    struct AllocationStats {
+        std::uint64_t count = 0;
+        std::uint64_t bytes = 0;
+        std::uint64_t peak_bytes = 0;  // highest live heap while the phase ran
+    };
+
+    struct PhaseRecord {
+        std::string name;
+        std::size_t depth = 0;  // nesting level, phases opened inside another phase are deeper
+        std::chrono::nanoseconds wall{};
+        std::chrono::nanoseconds cpu{};
+        std::optional<CounterValues> counters;
+        std::optional<AllocationStats> allocations;  // only with allocation tracking built in
+    };
+
+    // Collects the phases marked with ScopedPhase on the thread that created it. While a profiler is alive it is
+    // the thread's current one; without any, ScopedPhase costs a single thread-local load.
+    // Builds with AOC_TRACK_ALLOCATIONS=ON also record allocation count, bytes and peak live heap of every phase.
+    class Profiler {
+    public:
+        explicit Profiler(bool with_counters = false);
+        ~Profiler();
+
+        Profiler(const Profiler&) = delete;
+        Profiler& operator=(const Profiler&) = delete;
+        Profiler(Profiler&&) = delete;
+        Profiler& operator=(Profiler&&) = delete;
+
+        [[nodiscard]] static Profiler* current() noexcept;
+
+        [[nodiscard]] bool counters_available() const noexcept {
+            return counters_ && counters_->available();
+        }
+
+        [[nodiscard]] const std::vector<PhaseRecord>& records() const noexcept {
+            return records_;
+        }
+
+        // Human-readable table, one line per phase in the order the phases started.
+        void print(std::ostream& out) const;
+
+        // Array of phase objects: name, depth, wall_ns, cpu_ns, the counters that were available and, when tracked,
+        // the allocations.
+        void write_json(JsonWriter& json) const;
+
+    private:
+        friend class ScopedPhase;
+
+        std::size_t begin_phase(std::string_view name);
+        void end_phase(std::size_t index, std::chrono::nanoseconds wall, std::chrono::nanoseconds cpu);
+
+        [[nodiscard]] std::optional<CounterValues> sample_counters() const noexcept;
+
+    private:
+        std::optional<HardwareCounters> counters_;
+        std::vector<PhaseRecord> records_;
+        std::vector<std::optional<CounterValues>> started_;  // counter totals when each record started
+        std::vector<AllocationCounters> allocations_started_;  // allocation totals when each record started
+        std::vector<std::uint64_t> enclosing_peaks_;  // heap peak of the enclosing phases, restored on exit
+        std::size_t depth_ = 0;
+        Profiler* previous_ = nullptr;
+    };
+
+    // RAII phase marker: `core::ScopedPhase phase("parse");` records the enclosing scope into the current profiler.
+    class ScopedPhase {
+    public:
+        explicit ScopedPhase(std::string_view name);
+        ~ScopedPhase();
+
+        ScopedPhase(const ScopedPhase&) = delete;
+        ScopedPhase& operator=(const ScopedPhase&) = delete;
+        ScopedPhase(ScopedPhase&&) = delete;
+        ScopedPhase& operator=(ScopedPhase&&) = delete;
+
+    private:
+        Profiler* profiler_;
+        std::size_t index_ = 0;
+        std::chrono::steady_clock::time_point wall_start_;
+        std::chrono::nanoseconds cpu_start_{};
+    };
+}  // namespace core
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+
+namespace io {
+    class StreamReader;
+    class SnapshotWriter;
+    class Snapshot;
+}  // namespace io
+
+
+namespace aoc {
+    using Answer = std::uint64_t;
+
+    enum class Part : std::uint8_t { ONE = 1, TWO = 2 };
+
+    // A day's solver split into the phases we want to measure separately.
+    // `parse` may keep views into the input text, so the text must outlive the solution.
+    // Parsed structures should be built in `arena()`: a monotonic std::pmr resource owned by the solution, so the
+    // many small allocations of a loader come from a few large blocks that are all released with the solution.
+    class Solution {
+    public:
+        Solution() = default;
+        Solution(const Solution&) = delete;
+        Solution& operator=(const Solution&) = delete;
+        Solution(Solution&&) = delete;
+        Solution& operator=(Solution&&) = delete;
+        virtual ~Solution() = default;
+
+        virtual void parse(std::string_view input) = 0;
+
+        [[nodiscard]] virtual Answer solve(Part part) = 0;
+
+    protected:
+        // Declared in the base so it is constructed before, and destroyed after, every member of a derived solver.
+        // Members built on it must be constructed with it as well: std::pmr containers only steal each other's
+        // storage on move assignment when their resources compare equal.
+        [[nodiscard]] std::pmr::memory_resource* arena() noexcept {
+            return &arena_;
+        }
+
+    private:
+        std::pmr::monotonic_buffer_resource arena_;
+    };
+
+    // Extra interface for days whose answer is a running reduction over the input lines: they can be answered
+    // straight from an io::StreamReader in bounded memory, without `parse` ever holding the whole input.
+    class StreamingSolution {
+    public:
+        virtual ~StreamingSolution() = default;
+
+        [[nodiscard]] virtual Answer solve_stream(io::StreamReader& input, Part part) = 0;
+    };
+
+    // Extra interface for days whose parsed state is a few flat arrays: it can be saved as an io::Snapshot and
+    // mapped back later in place of `parse`, without touching the text or any element again.
+    class SnapshotSolution {
+    public:
+        virtual ~SnapshotSolution() = default;
+
+        // Adds the state built by `parse` to `out`, as the sections `load` expects.
+        virtual void save(io::SnapshotWriter& out) const = 0;
+
+        // Takes the state from `in` instead of parsing; views into it are kept, so `in` must outlive the solution.
+        virtual void load(const io::Snapshot& in) = 0;
+    };
+
+    // Thrown by a solver asked for a part it does not implement.
+    class UnsolvedPart : public std::invalid_argument {
+    public:
+        explicit UnsolvedPart(Part part);
+    };
+
+    // Registry entry describing one day.
+    struct Puzzle {
+        unsigned day = 0;
+        std::string_view name;
+        Part part = Part::ONE;  // the part the day answers by default
+        unsigned version = 1;   // bump whenever the parsed state changes shape, it retires the saved snapshots
+        bool slow = false;      // the default part does not finish on a real input; kept out of default suites
+        std::function<std::unique_ptr<Solution>()> create;
+    };
+
+    template<typename T>
+        requires std::is_base_of_v<Solution, T>
+    Puzzle make_puzzle(unsigned day, std::string_view name, Part part) {
+        return Puzzle{
+            .day = day,
+            .name = name,
+            .part = part,
+            .create = []() -> std::unique_ptr<Solution> { return std::make_unique<T>(); },
+        };
+    }
+
+    // Command-line front end that is the whole body of every day's main(); returns the process exit code.
+    //   <day> [--part 1|2] [--warmup <runs>] [--repeat <runs>] [--no-cache]
+    //         [--snapshot <file> | --save-snapshot <file>] [<input>|-]
+    // Solves the input (input.txt by default, '-' for stdin) `warmup + repeat` times and prints the answer. With more
+    // than one measured run the min/median/mean/stddev of the parse, solve and total times follow on stderr.
+    // A single unprofiled run answers from the ResultCache when it can (unless --no-cache) and fills it otherwise.
+    // Days implementing SnapshotSolution can save their parsed input and later start from it instead of the text.
+    // With AOC_PROFILE=1 (or =json) set, the load/parse/solve/output phases, any core::ScopedPhase marked inside
+    // the solver and the hardware counters of each are reported on stderr, as are their allocations in builds with
+    // AOC_TRACK_ALLOCATIONS=ON. Days that report per-line diagnostics write them to io::trace() when AOC_TRACE is set.
+    int solve_puzzle(const Puzzle& puzzle, int argc, char** argv);
+}  // namespace aoc
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <common/io.hpp>
+
+
+namespace io {
+    // A snapshot is the binary image of a solver's parsed state: a header naming the day and the solver version,
+    // then flat sections of trivially copyable elements, each at a 64-byte aligned offset. Only offsets are stored,
+    // so a mapping of the file is used in place wherever it lands. The layout is the host's own (byte order and
+    // element sizes are checked on load), a snapshot is a local warm start and not an exchange format.
+    class SnapshotWriter {
+    public:
+        // Sections are numbered in the order they are added.
+        template<std::ranges::contiguous_range Range>
+            requires std::is_trivially_copyable_v<std::ranges::range_value_t<Range>>
+        void add(const Range& elements) {
+            using T = std::ranges::range_value_t<Range>;
+            const std::span<const T> view(std::ranges::data(elements), std::ranges::size(elements));
+
+            auto& section = sections_.emplace_back(Section{
+                .element_size = sizeof(T),
+                .alignment = alignof(T),
+                .count = view.size(),
+                .bytes = std::vector<std::byte>(view.size_bytes()),
+            });
+            if (!view.empty()) {
+                std::memcpy(section.bytes.data(), view.data(), view.size_bytes());
+            }
+        }
+
+        // Throws std::runtime_error when the file cannot be written.
+        void write(const std::filesystem::path& path, std::uint32_t day, std::uint32_t version) const;
+
+    private:
+        struct Section {
+            std::uint32_t element_size = 0;
+            std::uint32_t alignment = 0;
+            std::uint64_t count = 0;
+            std::vector<std::byte> bytes;
+        };
+
+        std::vector<Section> sections_;
+    };
+
+    // Read-only mapping of a snapshot; the spans it hands out point into the file and live as long as the object.
+    class Snapshot {
+    public:
+        // Throws std::invalid_argument when the file is not a snapshot of this format and host.
+        explicit Snapshot(const std::filesystem::path& path);
+
+        [[nodiscard]] std::uint32_t day() const noexcept {
+            return day_;
+        }
+
+        [[nodiscard]] std::uint32_t version() const noexcept {
+            return version_;
+        }
+
+        [[nodiscard]] std::size_t sections() const noexcept {
+            return sections_;
+        }
+
+        // Throws std::invalid_argument when the section is missing or holds elements of another size.
+        template<typename T>
+            requires std::is_trivially_copyable_v<T>
+        [[nodiscard]] std::span<const T> section(std::size_t index) const {
+            const auto [bytes, count] = locate(index, sizeof(T), alignof(T));
+            return {reinterpret_cast<const T*>(bytes), count};
+        }
+
+    private:
+        [[nodiscard]] std::pair<const char*, std::size_t> locate(
+            std::size_t index, std::size_t element_size, std::size_t alignment
+        ) const;
+
+    private:
+        MappedFile file_;
+        std::uint32_t day_ = 0;
+        std::uint32_t version_ = 0;
+        std::size_t sections_ = 0;
+    };
+}  // namespace io
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+
+namespace core {
+    // Order statistics of a set of repeated measurements.
+    struct Summary {
+        std::size_t count = 0;
+        double min = 0;
+        double max = 0;
+        double mean = 0;
+        double median = 0;
+        double p99 = 0;
+        double stddev = 0;  // sample standard deviation
+    };
+
+    [[nodiscard]] Summary summarize(std::vector<double> samples);
+
+    // Nearest-rank percentile of already sorted samples, `fraction` in [0, 1].
+    [[nodiscard]] double percentile(const std::vector<double>& sorted, double fraction);
+
+    // Mann-Whitney U test of two independent sets of measurements. It does not assume normally distributed
+    // timings, only that a run is as likely to be slow in either set when nothing changed.
+    struct RankTest {
+        double u = 0;  // how many (x, y) pairs have x > y, ties counting one half
+        // One-sided p-values from the normal approximation with tie and continuity corrections; reasonable from
+        // about eight samples per side. Both are 1 when either side is empty or every sample is tied.
+        double p_greater = 1;  // evidence that x tends to be larger than y
+        double p_less = 1;     // evidence that x tends to be smaller than y
+    };
+
+    [[nodiscard]] RankTest mann_whitney(const std::vector<double>& x, const std::vector<double>& y);
+}  // namespace core
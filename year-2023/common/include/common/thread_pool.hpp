@@ -0,0 +1,68 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace core {
+    // Fixed-size pool where every worker owns a task deque.
+    // A worker pops its own newest task first and, when it runs dry, steals the oldest task of another worker,
+    // so a few long tasks cannot leave the rest of the machine idle behind them.
+    class ThreadPool {
+    public:
+        using Task = std::function<void()>;
+
+        explicit ThreadPool(std::size_t threads = std::thread::hardware_concurrency());
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+        ThreadPool(ThreadPool&&) = delete;
+        ThreadPool& operator=(ThreadPool&&) = delete;
+
+        // Tasks submitted from a worker go to that worker's own deque, others are spread round-robin.
+        void submit(Task task);
+
+        // Blocks until every submitted task has finished; rethrows the first exception a task let escape.
+        // Must not be called from inside a task.
+        void wait();
+
+        [[nodiscard]] std::size_t size() const noexcept {
+            return threads_.size();
+        }
+
+        // Whether the calling thread is a worker of some pool, so nested parallel work can run inline instead of
+        // starting threads of its own.
+        [[nodiscard]] static bool in_worker() noexcept;
+
+    private:
+        struct Queue {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        void run(std::size_t index);
+        bool try_pop(std::size_t index, Task& task);
+        void finish_task(std::exception_ptr error);
+
+    private:
+        std::vector<std::unique_ptr<Queue>> queues_;
+        std::vector<std::thread> threads_;
+
+        std::mutex mutex_;  // taken before a queue's mutex when both are held
+        std::condition_variable wake_;
+        std::condition_variable idle_;
+        std::size_t queued_ = 0;   // tasks sitting in some deque
+        std::size_t pending_ = 0;  // tasks submitted but not finished yet
+        std::size_t next_queue_ = 0;
+        std::exception_ptr error_;
+        bool stopping_ = false;
+    };
+}  // namespace core
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <chrono>
+
+
+namespace core {
+    // CPU time consumed so far by the calling thread.
+    [[nodiscard]] std::chrono::nanoseconds thread_cpu_time() noexcept;
+
+    // CPU time consumed so far by the whole process.
+    [[nodiscard]] std::chrono::nanoseconds process_cpu_time() noexcept;
+}  // namespace core
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+
+namespace io {
+    // Collects diagnostic records in a large buffer and writes it out a block at a time, so tracing every line of
+    // a big input costs a copy per record instead of a flush. Safe to use from several threads: a record is appended
+    // whole, and records of different threads end up interleaved in the order they were made.
+    class TraceSink {
+    public:
+        static constexpr std::size_t BlockSize = std::size_t{1} << 16;
+
+        // `out` stays owned by the caller; the sink only writes to it.
+        explicit TraceSink(std::FILE* out);
+        TraceSink(const TraceSink&) = delete;
+        TraceSink& operator=(const TraceSink&) = delete;
+        ~TraceSink();
+
+        // Appends one line made of `fields`: strings as they are, integers in decimal.
+        template<typename... Fields>
+        void record(const Fields&... fields) {
+            const std::lock_guard lock(mutex_);
+            (append(fields), ...);
+            buffer_ += '\n';
+            if (buffer_.size() >= BlockSize) {
+                write_out();
+            }
+        }
+
+        void flush();
+
+    private:
+        void append(std::string_view text) {
+            buffer_ += text;
+        }
+
+        template<typename T>
+            requires std::is_integral_v<T>
+        void append(T value) {
+            char digits[24];
+            const auto [end, _] = std::to_chars(digits, digits + sizeof(digits), value);
+            buffer_.append(digits, end);
+        }
+
+        // Writes the buffer to `out_`, with the lock held.
+        void write_out();
+
+    private:
+        std::FILE* out_;
+        std::mutex mutex_;
+        std::string buffer_;
+    };
+
+    // The sink that AOC_TRACE asks for, or nullptr when tracing is off, so a solver checks once and keeps its quiet
+    // path free of diagnostics: AOC_TRACE=1 traces to stderr, any other value is a file to write the trace to.
+    // The sink is flushed when the program exits.
+    TraceSink* trace();
+}  // namespace io
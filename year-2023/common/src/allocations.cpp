@@ -0,0 +1,210 @@
+#include <common/allocations.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+
+namespace core {
+    namespace {
+        std::atomic<std::uint64_t> allocation_count{0};
+        std::atomic<std::uint64_t> allocated_bytes{0};
+        std::atomic<std::uint64_t> live_bytes{0};
+        std::atomic<std::uint64_t> peak_bytes{0};
+
+        void raise_peak(std::uint64_t value) noexcept {
+            auto peak = peak_bytes.load(std::memory_order_relaxed);
+            while (peak < value && !peak_bytes.compare_exchange_weak(peak, value, std::memory_order_relaxed)) {
+            }
+        }
+    }  // namespace
+
+
+#ifdef AOC_TRACK_ALLOCATIONS
+    namespace {
+        // Every block starts with a header whose last bytes hold the requested size, so delete knows what it frees.
+        constexpr std::size_t HeaderSize = alignof(std::max_align_t);
+
+        std::size_t header_size(std::size_t alignment) noexcept {
+            return std::max(HeaderSize, alignment);
+        }
+
+        void* allocate(std::size_t size, std::size_t alignment) noexcept {
+            const auto header = header_size(alignment);
+            void* block = nullptr;
+            if (alignment <= HeaderSize) {
+                block = std::malloc(header + size);
+            } else {
+#ifdef _WIN32
+                block = ::_aligned_malloc(header + size, alignment);
+#else
+                // aligned_alloc wants a multiple of the alignment
+                block = std::aligned_alloc(alignment, (header + size + alignment - 1) / alignment * alignment);
+#endif
+            }
+            if (block == nullptr) {
+                return nullptr;
+            }
+
+            auto* const user = static_cast<std::byte*>(block) + header;
+            std::memcpy(user - sizeof(std::size_t), &size, sizeof(std::size_t));
+
+            allocation_count.fetch_add(1, std::memory_order_relaxed);
+            allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+            raise_peak(live_bytes.fetch_add(size, std::memory_order_relaxed) + size);
+            return user;
+        }
+
+        void release(void* pointer, std::size_t alignment) noexcept {
+            if (pointer == nullptr) {
+                return;
+            }
+
+            auto* const user = static_cast<std::byte*>(pointer);
+            std::size_t size = 0;
+            std::memcpy(&size, user - sizeof(std::size_t), sizeof(std::size_t));
+            live_bytes.fetch_sub(size, std::memory_order_relaxed);
+
+            void* const block = user - header_size(alignment);
+#ifdef _WIN32
+            if (alignment > HeaderSize) {
+                ::_aligned_free(block);
+                return;
+            }
+#endif
+            std::free(block);
+        }
+
+        void* allocate_or_throw(std::size_t size, std::size_t alignment) {
+            while (true) {
+                if (void* const pointer = allocate(size, alignment)) {
+                    return pointer;
+                }
+                const auto handler = std::get_new_handler();
+                if (handler == nullptr) {
+                    throw std::bad_alloc();
+                }
+                handler();
+            }
+        }
+
+        std::size_t alignment_of(std::align_val_t alignment) noexcept {
+            return static_cast<std::size_t>(alignment);
+        }
+    }  // namespace
+#endif
+
+
+    bool allocation_tracking() noexcept {
+#ifdef AOC_TRACK_ALLOCATIONS
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    AllocationCounters allocation_counters() noexcept {
+        return AllocationCounters{
+            .count = allocation_count.load(std::memory_order_relaxed),
+            .bytes = allocated_bytes.load(std::memory_order_relaxed),
+            .live_bytes = live_bytes.load(std::memory_order_relaxed),
+            .peak_bytes = peak_bytes.load(std::memory_order_relaxed),
+        };
+    }
+
+    std::uint64_t reset_allocation_peak() noexcept {
+        return peak_bytes.exchange(live_bytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+    void restore_allocation_peak(std::uint64_t peak) noexcept {
+        raise_peak(peak);
+    }
+}  // namespace core
+
+
+#ifdef AOC_TRACK_ALLOCATIONS
+// The replaceable global allocation functions. Each pair goes through the same allocate/release so a block is
+// always freed the way it was allocated, whatever form of new or delete the caller used.
+void* operator new(std::size_t size) {
+    return core::allocate_or_throw(size, 0);
+}
+
+void* operator new[](std::size_t size) {
+    return core::allocate_or_throw(size, 0);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return core::allocate_or_throw(size, core::alignment_of(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return core::allocate_or_throw(size, core::alignment_of(alignment));
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return core::allocate(size, 0);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return core::allocate(size, 0);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return core::allocate(size, core::alignment_of(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return core::allocate(size, core::alignment_of(alignment));
+}
+
+void operator delete(void* pointer) noexcept {
+    core::release(pointer, 0);
+}
+
+void operator delete[](void* pointer) noexcept {
+    core::release(pointer, 0);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    core::release(pointer, 0);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+    core::release(pointer, 0);
+}
+
+void operator delete(void* pointer, std::align_val_t alignment) noexcept {
+    core::release(pointer, core::alignment_of(alignment));
+}
+
+void operator delete[](void* pointer, std::align_val_t alignment) noexcept {
+    core::release(pointer, core::alignment_of(alignment));
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t alignment) noexcept {
+    core::release(pointer, core::alignment_of(alignment));
+}
+
+void operator delete[](void* pointer, std::size_t, std::align_val_t alignment) noexcept {
+    core::release(pointer, core::alignment_of(alignment));
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept {
+    core::release(pointer, 0);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept {
+    core::release(pointer, 0);
+}
+
+void operator delete(void* pointer, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    core::release(pointer, core::alignment_of(alignment));
+}
+
+void operator delete[](void* pointer, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    core::release(pointer, core::alignment_of(alignment));
+}
+#endif
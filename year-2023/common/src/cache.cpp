@@ -0,0 +1,177 @@
+#include <common/cache.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <random>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
+
+#include <common/hash.hpp>
+#include <common/io.hpp>
+
+
+namespace aoc {
+    namespace {
+        // part of every key, bump it when the entry format changes
+        constexpr unsigned FormatVersion = 1;
+
+        std::optional<std::filesystem::path> from_environment(const char* variable) {
+            const char* value = std::getenv(variable);
+            if (value == nullptr || *value == '\0') {
+                return std::nullopt;
+            }
+            return std::filesystem::path(value);
+        }
+
+        // Hash of the running executable. Any change to a solver, or to the code it is built with, gives another
+        // build and so retires the answers of the previous one, whether or not its Puzzle::version was bumped.
+        std::optional<std::uint64_t> build_fingerprint() {
+            static const auto fingerprint = []() -> std::optional<std::uint64_t> {
+                try {
+#ifdef _WIN32
+                    std::wstring path(MAX_PATH, L'\0');
+                    DWORD length = 0;
+                    while ((length = GetModuleFileNameW(nullptr, path.data(), static_cast<DWORD>(path.size())))
+                           == path.size()) {
+                        path.resize(path.size() * 2);
+                    }
+                    if (length == 0) {
+                        return std::nullopt;
+                    }
+                    path.resize(length);
+                    const io::MappedFile executable{std::filesystem::path(path)};
+#else
+                    const io::MappedFile executable{std::filesystem::path("/proc/self/exe")};
+#endif
+                    return core::hash_bytes(executable.view());
+                } catch (const std::exception&) {
+                    return std::nullopt;
+                }
+            }();
+            return fingerprint;
+        }
+
+        std::string to_hex(std::uint64_t value) {
+            constexpr std::string_view Digits = "0123456789abcdef";
+            std::string text(16, '0');
+            for (auto it = text.rbegin(); it != text.rend(); ++it, value >>= 4) {
+                *it = Digits[value & 0xF];
+            }
+            return text;
+        }
+    }  // namespace
+
+
+    ResultCache::ResultCache(std::filesystem::path directory, std::size_t capacity)
+        : directory_(std::move(directory))
+        , capacity_(std::max<std::size_t>(capacity, 1)) {}
+
+    std::filesystem::path ResultCache::default_directory() {
+        if (auto directory = from_environment("AOC_CACHE_DIR")) {
+            return *directory;
+        }
+#ifdef _WIN32
+        if (auto directory = from_environment("LOCALAPPDATA")) {
+            return *directory / "aoc";
+        }
+#else
+        if (auto directory = from_environment("XDG_CACHE_HOME")) {
+            return *directory / "aoc";
+        }
+        if (auto directory = from_environment("HOME")) {
+            return *directory / ".cache" / "aoc";
+        }
+#endif
+        std::error_code error;
+        return std::filesystem::temp_directory_path(error) / "aoc-cache";
+    }
+
+    std::optional<ResultCache::Key> ResultCache::make_key(const Puzzle& puzzle, Part part, std::string_view input) {
+        const auto build = build_fingerprint();
+        if (!build) {
+            return std::nullopt;
+        }
+
+        // day-5.2.v1.f1.<build>.<hash>: readable enough to clear a single day by hand
+        auto name = "day-" + std::to_string(puzzle.day) + '.' + std::to_string(static_cast<int>(part)) + ".v"
+                  + std::to_string(puzzle.version) + ".f" + std::to_string(FormatVersion) + '.' + to_hex(*build)
+                  + '.' + to_hex(core::hash_bytes(input));
+        return Key{.name = std::move(name), .input_size = input.size()};
+    }
+
+    std::optional<Answer> ResultCache::find(const Key& key) const {
+        const auto path = directory_ / key.name;
+        std::ifstream entry(path);
+
+        // the input size is kept next to the answer as a cheap second check against hash collisions
+        std::uint64_t input_size = 0;
+        Answer answer = 0;
+        if (!(entry >> input_size >> answer) || input_size != key.input_size) {
+            return std::nullopt;
+        }
+
+        std::error_code error;
+        std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), error);
+        return answer;
+    }
+
+    void ResultCache::store(const Key& key, Answer answer) const {
+        std::error_code error;
+        std::filesystem::create_directories(directory_, error);
+        if (error) {
+            return;
+        }
+
+        // written next to the entry and renamed over it, so a reader never sees half a file
+        const auto path = directory_ / key.name;
+        auto temporary = path;
+        temporary += ".tmp" + std::to_string(std::random_device{}());
+        {
+            std::ofstream entry(temporary, std::ios::trunc);
+            if (!(entry << key.input_size << ' ' << answer << '\n')) {
+                entry.close();
+                std::filesystem::remove(temporary, error);
+                return;
+            }
+        }
+        std::filesystem::rename(temporary, path, error);
+        if (error) {
+            std::filesystem::remove(temporary, error);
+            return;
+        }
+
+        evict();
+    }
+
+    void ResultCache::evict() const {
+        std::vector<std::pair<std::filesystem::file_time_type, std::filesystem::path>> entries;
+
+        std::error_code error;
+        for (std::filesystem::directory_iterator it(directory_, error), end; !error && it != end; it.increment(error)) {
+            const auto name = it->path().filename().string();
+            if (name.starts_with("day-") && name.find(".tmp") == std::string::npos && it->is_regular_file(error)) {
+                entries.emplace_back(it->last_write_time(error), it->path());
+            }
+        }
+        if (entries.size() <= capacity_) {
+            return;
+        }
+
+        const auto excess = static_cast<std::ptrdiff_t>(entries.size() - capacity_);
+        std::nth_element(entries.begin(), entries.begin() + excess, entries.end());
+        for (auto it = entries.begin(); it != entries.begin() + excess; ++it) {
+            std::filesystem::remove(it->second, error);
+        }
+    }
+}  // namespace aoc
@@ -0,0 +1,43 @@
+#include <common/graph.hpp>
+
+#include <stdexcept>
+
+
+namespace core {
+    NodeId Interner::intern(std::string_view name) {
+        const auto [position, inserted] = ids_.try_emplace(name, static_cast<NodeId>(names_.size()));
+        if (inserted) {
+            names_.push_back(name);
+        }
+        return position->second;
+    }
+
+    std::optional<NodeId> Interner::find(std::string_view name) const {
+        const auto position = ids_.find(name);
+        if (position == ids_.end()) {
+            return std::nullopt;
+        }
+        return position->second;
+    }
+
+
+    Graph::Graph(std::size_t nodes, std::span<const Edge> edges, std::pmr::memory_resource* memory)
+        : offsets_(nodes + 1, 0, memory)
+        , targets_(edges.size(), 0, memory) {
+        // counting sort by source node, stable so every node keeps its successors in the order they were added
+        for (const auto& edge : edges) {
+            if (edge.from >= nodes || edge.to >= nodes) {
+                throw std::out_of_range("edge to a node outside the graph");
+            }
+            offsets_[edge.from + 1]++;
+        }
+        for (std::size_t node = 0; node != nodes; node++) {
+            offsets_[node + 1] += offsets_[node];
+        }
+
+        std::pmr::vector<std::uint32_t> next(offsets_.begin(), offsets_.end() - 1, memory);
+        for (const auto& edge : edges) {
+            targets_[next[edge.from]++] = edge.to;
+        }
+    }
+}  // namespace core
@@ -0,0 +1,97 @@
+#include <common/grid.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#include <common/io.hpp>
+
+
+namespace core {
+    Grid<char> load_grid(std::string_view document, char border, std::pmr::memory_resource* memory) {
+        std::size_t rows = 0;
+        std::size_t cols = 0;
+        for (const auto line : io::lines(document)) {
+            if (line.empty()) {
+                break;
+            }
+            if (rows != 0 && line.size() != cols) {
+                throw std::invalid_argument(
+                    "line " + std::to_string(rows + 1) + " is " + std::to_string(line.size()) + " cells wide, not "
+                    + std::to_string(cols)
+                );
+            }
+            cols = line.size();
+            rows++;
+        }
+
+        Grid<char> grid(rows, cols, border, memory);
+        std::size_t row = 0;
+        for (const auto line : io::lines(document)) {
+            if (row == rows) {
+                break;
+            }
+            std::ranges::copy(line, grid.row(row++).begin());
+        }
+        return grid;
+    }
+
+
+    void BitGrid::invert() noexcept {
+        for (auto& word : words_) {
+            word = ~word;
+        }
+        clear_padding();
+    }
+
+    BitGrid& BitGrid::operator&=(const BitGrid& other) noexcept {
+        std::ranges::transform(words_, other.words_, words_.begin(), [](Word left, Word right) {
+            return left & right;
+        });
+        return *this;
+    }
+
+    BitGrid& BitGrid::operator|=(const BitGrid& other) noexcept {
+        std::ranges::transform(words_, other.words_, words_.begin(), [](Word left, Word right) {
+            return left | right;
+        });
+        return *this;
+    }
+
+    void BitGrid::step(const BitGrid& from, const BitGrid& open) noexcept {
+        const auto rows = static_cast<std::ptrdiff_t>(rows_);
+        for (std::ptrdiff_t r = 0; r != rows; r++) {
+            const auto above = from.row(r - 1);
+            const auto current = from.row(r);
+            const auto below = from.row(r + 1);
+            const auto mask = open.row(r);
+            auto target = row(r);
+
+            // a cell is reached from the cell on its left (a shift towards higher bits) or on its right; the
+            // padding columns stop bits from wrapping between rows, and carries cross word boundaries
+            Word carry_up = 0;
+            for (std::size_t w = 0; w != row_words_; w++) {
+                const auto word = current[w];
+                const auto next = w + 1 != row_words_ ? current[w + 1] : Word{0};
+                const auto from_left = word << 1 | carry_up;
+                const auto from_right = word >> 1 | next << (WordBits - 1);
+                carry_up = word >> (WordBits - 1);
+                target[w] = (above[w] | below[w] | from_left | from_right) & mask[w];
+            }
+        }
+    }
+
+    void BitGrid::clear_padding() noexcept {
+        std::ranges::fill(row(-1), Word{0});
+        std::ranges::fill(row(static_cast<std::ptrdiff_t>(rows_)), Word{0});
+
+        // bit 0 and every bit from column cols_ + 1 on are padding
+        const auto last = cols_ + 1;
+        for (std::size_t r = 0; r != rows_; r++) {
+            auto words = row(static_cast<std::ptrdiff_t>(r));
+            words[0] &= ~Word{1};
+            words[last / WordBits] &= (Word{1} << (last % WordBits)) - 1;
+            std::ranges::fill(words.subspan(last / WordBits + 1), Word{0});
+        }
+    }
+}  // namespace core
@@ -0,0 +1,86 @@
+#include <common/hash.hpp>
+
+#include <bit>
+#include <cstddef>
+#include <cstring>
+
+
+namespace core {
+    namespace {
+        constexpr std::uint64_t Prime1 = 0x9E3779B185EBCA87;
+        constexpr std::uint64_t Prime2 = 0xC2B2AE3D27D4EB4F;
+        constexpr std::uint64_t Prime3 = 0x165667B19E3779F9;
+        constexpr std::uint64_t Prime4 = 0x85EBCA77C2B2AE63;
+        constexpr std::uint64_t Prime5 = 0x27D4EB2F165667C5;
+
+        // the reference hash reads little-endian words, so the result is the same on every host
+        template<typename T>
+        T read(const char* bytes) noexcept {
+            T value = 0;
+            if constexpr (std::endian::native == std::endian::little) {
+                std::memcpy(&value, bytes, sizeof(value));
+            } else {
+                for (std::size_t i = sizeof(T); i-- != 0;) {
+                    value = static_cast<T>((value << 8) | static_cast<unsigned char>(bytes[i]));
+                }
+            }
+            return value;
+        }
+
+        std::uint64_t round(std::uint64_t accumulator, std::uint64_t input) noexcept {
+            accumulator += input * Prime2;
+            return std::rotl(accumulator, 31) * Prime1;
+        }
+
+        std::uint64_t merge_round(std::uint64_t hash, std::uint64_t lane) noexcept {
+            hash ^= round(0, lane);
+            return hash * Prime1 + Prime4;
+        }
+    }  // namespace
+
+
+    std::uint64_t hash_bytes(std::string_view bytes, std::uint64_t seed) noexcept {
+        const char* cursor = bytes.data();
+        const char* const end = cursor + bytes.size();
+
+        std::uint64_t hash = 0;
+        if (bytes.size() >= 32) {
+            // four independent lanes keep several multiplies in flight
+            std::uint64_t lanes[4] = {seed + Prime1 + Prime2, seed + Prime2, seed, seed - Prime1};
+            for (; end - cursor >= 32; cursor += 32) {
+                for (std::size_t lane = 0; lane != 4; lane++) {
+                    lanes[lane] = round(lanes[lane], read<std::uint64_t>(cursor + 8 * lane));
+                }
+            }
+
+            hash = std::rotl(lanes[0], 1) + std::rotl(lanes[1], 7) + std::rotl(lanes[2], 12) + std::rotl(lanes[3], 18);
+            for (const auto lane : lanes) {
+                hash = merge_round(hash, lane);
+            }
+        } else {
+            hash = seed + Prime5;
+        }
+        hash += bytes.size();
+
+        for (; end - cursor >= 8; cursor += 8) {
+            hash ^= round(0, read<std::uint64_t>(cursor));
+            hash = std::rotl(hash, 27) * Prime1 + Prime4;
+        }
+        if (end - cursor >= 4) {
+            hash ^= std::uint64_t{read<std::uint32_t>(cursor)} * Prime1;
+            hash = std::rotl(hash, 23) * Prime2 + Prime3;
+            cursor += 4;
+        }
+        for (; cursor != end; cursor++) {
+            hash ^= std::uint64_t{static_cast<unsigned char>(*cursor)} * Prime5;
+            hash = std::rotl(hash, 11) * Prime1;
+        }
+
+        hash ^= hash >> 33;
+        hash *= Prime2;
+        hash ^= hash >> 29;
+        hash *= Prime3;
+        hash ^= hash >> 32;
+        return hash;
+    }
+}  // namespace core
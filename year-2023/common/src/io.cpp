@@ -0,0 +1,316 @@
+#include <common/io.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+namespace io {
+    namespace {
+        [[noreturn]] void throw_system_error(const std::filesystem::path& path, const char* what) {
+#ifdef _WIN32
+            const auto code = static_cast<int>(::GetLastError());
+#else
+            const auto code = errno;
+#endif
+            throw std::system_error(code, std::system_category(), std::string(what) + " '" + path.string() + "'");
+        }
+
+        std::FILE* open_stream(const std::filesystem::path& path) {
+#ifdef _WIN32
+            return ::_wfopen(path.c_str(), L"rb");
+#else
+            return std::fopen(path.c_str(), "rb");
+#endif
+        }
+
+        std::uint32_t count_trailing_zeros(std::uint32_t mask) noexcept {
+#ifdef _MSC_VER
+            unsigned long index = 0;
+            _BitScanForward(&index, mask);
+            return index;
+#else
+            return static_cast<std::uint32_t>(__builtin_ctz(mask));
+#endif
+        }
+    }  // namespace
+
+
+    MappedFile::MappedFile(const std::filesystem::path& path) {
+#ifdef _WIN32
+        file_ = ::CreateFileW(
+            path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr
+        );
+        if (file_ == INVALID_HANDLE_VALUE) {
+            file_ = nullptr;
+            throw_system_error(path, "unable to open");
+        }
+
+        LARGE_INTEGER size{};
+        if (!::GetFileSizeEx(file_, &size)) {
+            release();
+            throw_system_error(path, "unable to stat");
+        }
+
+        size_ = static_cast<std::size_t>(size.QuadPart);
+        if (size_ == 0) {
+            return;
+        }
+
+        mapping_ = ::CreateFileMappingW(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping_ == nullptr) {
+            release();
+            throw_system_error(path, "unable to map");
+        }
+
+        data_ = static_cast<const char*>(::MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+        if (data_ == nullptr) {
+            release();
+            throw_system_error(path, "unable to map");
+        }
+#else
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            throw_system_error(path, "unable to open");
+        }
+
+        struct stat info {};
+        if (::fstat(fd, &info) != 0) {
+            ::close(fd);
+            throw_system_error(path, "unable to stat");
+        }
+
+        size_ = static_cast<std::size_t>(info.st_size);
+        if (size_ != 0) {
+            void* address = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (address == MAP_FAILED) {
+                ::close(fd);
+                size_ = 0;
+                throw_system_error(path, "unable to map");
+            }
+
+            ::madvise(address, size_, MADV_SEQUENTIAL);
+            data_ = static_cast<const char*>(address);
+        }
+
+        // the mapping keeps its own reference to the file
+        ::close(fd);
+#endif
+    }
+
+    MappedFile::~MappedFile() {
+        release();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+        : data_(std::exchange(other.data_, nullptr))
+        , size_(std::exchange(other.size_, 0))
+#ifdef _WIN32
+        , file_(std::exchange(other.file_, nullptr))
+        , mapping_(std::exchange(other.mapping_, nullptr))
+#endif
+    {
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            release();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+#ifdef _WIN32
+            file_ = std::exchange(other.file_, nullptr);
+            mapping_ = std::exchange(other.mapping_, nullptr);
+#endif
+        }
+        return *this;
+    }
+
+    void MappedFile::release() noexcept {
+#ifdef _WIN32
+        if (data_ != nullptr) {
+            ::UnmapViewOfFile(data_);
+        }
+        if (mapping_ != nullptr) {
+            ::CloseHandle(mapping_);
+        }
+        if (file_ != nullptr) {
+            ::CloseHandle(file_);
+        }
+        file_ = nullptr;
+        mapping_ = nullptr;
+#else
+        if (data_ != nullptr) {
+            ::munmap(const_cast<char*>(data_), size_);
+        }
+#endif
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+
+    const char* find_newline(const char* begin, const char* end) noexcept {
+#if defined(__AVX2__)
+        const auto pattern = _mm256_set1_epi8('\n');
+        for (; begin + 32 <= end; begin += 32) {
+            const auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin));
+            const auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, pattern)));
+            if (mask != 0) {
+                return begin + count_trailing_zeros(mask);
+            }
+        }
+#elif defined(__SSE2__) || defined(_M_X64)
+        const auto pattern = _mm_set1_epi8('\n');
+        for (; begin + 16 <= end; begin += 16) {
+            const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+            const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, pattern)));
+            if (mask != 0) {
+                return begin + count_trailing_zeros(mask);
+            }
+        }
+#endif
+
+        const auto* const found =
+            static_cast<const char*>(std::memchr(begin, '\n', static_cast<std::size_t>(end - begin)));
+        return found != nullptr ? found : end;
+    }
+
+
+    StreamReader::StreamReader(const std::filesystem::path& path, std::size_t chunk_size)
+        : StreamReader(open_stream(path), chunk_size) {
+        if (stream_ == nullptr) {
+            throw_system_error(path, "unable to open");
+        }
+        owned_ = true;
+    }
+
+    StreamReader::StreamReader(std::FILE* stream, std::size_t chunk_size)
+        : stream_(stream)
+        , buffer_(std::max<std::size_t>(chunk_size, 1)) {}
+
+    StreamReader::~StreamReader() {
+        if (owned_) {
+            std::fclose(stream_);
+        }
+    }
+
+    bool StreamReader::next(std::string_view& line) {
+        while (true) {
+            const char* const first = buffer_.data() + begin_;
+            const char* const last = buffer_.data() + end_;
+
+            const char* const newline = find_newline(first, last);
+            if (newline != last) {
+                line = trim_line(std::string_view(first, static_cast<std::size_t>(newline - first)));
+                begin_ = static_cast<std::size_t>(newline - buffer_.data()) + 1;
+                return true;
+            }
+
+            if (eof_) {
+                if (begin_ == end_) {
+                    return false;
+                }
+                line = trim_line(std::string_view(first, static_cast<std::size_t>(last - first)));
+                begin_ = end_;
+                return true;
+            }
+
+            refill();
+        }
+    }
+
+    void StreamReader::refill() {
+        // keep the unfinished line, it moves to the front of the buffer
+        if (begin_ != 0) {
+            std::memmove(buffer_.data(), buffer_.data() + begin_, end_ - begin_);
+            end_ -= begin_;
+            begin_ = 0;
+        }
+        if (end_ == buffer_.size()) {
+            buffer_.resize(buffer_.size() * 2);
+        }
+
+        // fread only comes back short at the end of the stream or on an error
+        const auto requested = buffer_.size() - end_;
+        const auto count = std::fread(buffer_.data() + end_, 1, requested, stream_);
+        end_ += count;
+        if (count != requested) {
+            if (std::ferror(stream_) != 0) {
+                throw std::system_error(errno, std::system_category(), "unable to read the input stream");
+            }
+            eof_ = true;
+        }
+    }
+
+
+    std::string read_stream(std::FILE* stream) {
+        std::string content;
+        std::size_t size = 0;
+        while (true) {
+            content.resize(std::max<std::size_t>(2 * size, StreamReader::DefaultChunkSize));
+            const auto requested = content.size() - size;
+            const auto count = std::fread(content.data() + size, 1, requested, stream);
+            size += count;
+            if (count != requested) {
+                break;
+            }
+        }
+
+        if (std::ferror(stream) != 0) {
+            throw std::system_error(errno, std::system_category(), "unable to read the input stream");
+        }
+        content.resize(size);
+        return content;
+    }
+
+
+    std::vector<std::string_view> split_lines(std::string_view text, std::size_t chunk_size) {
+        std::vector<std::string_view> chunks;
+        chunk_size = std::max<std::size_t>(chunk_size, 1);
+        chunks.reserve(text.size() / chunk_size + 1);
+
+        const char* cursor = text.data();
+        const char* const end = text.data() + text.size();
+        while (cursor != end) {
+            const auto* const target = cursor + std::min(chunk_size, static_cast<std::size_t>(end - cursor));
+            // the chunk takes the rest of the line it stops in, newline included
+            const auto* const newline = target == end ? end : find_newline(target - 1, end);
+            const auto* const next = newline == end ? end : newline + 1;
+
+            chunks.emplace_back(cursor, static_cast<std::size_t>(next - cursor));
+            cursor = next;
+        }
+
+        return chunks;
+    }
+
+
+    void Scanner::fail(std::string_view expected) const {
+        std::string message;
+        if (line_number_ != 0) {
+            message += "line " + std::to_string(line_number_) + ", ";
+        }
+        message += "column " + std::to_string(position_ + 1) + ": expected " + std::string(expected) + " in \""
+            + std::string(line_) + '"';
+        throw std::invalid_argument(message);
+    }
+}  // namespace io
@@ -0,0 +1,442 @@
+#include <common/json.hpp>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+
+namespace core {
+    JsonWriter& JsonWriter::begin_object() {
+        open('{');
+        return *this;
+    }
+
+    JsonWriter& JsonWriter::end_object() {
+        close('}');
+        return *this;
+    }
+
+    JsonWriter& JsonWriter::begin_array() {
+        open('[');
+        return *this;
+    }
+
+    JsonWriter& JsonWriter::end_array() {
+        close(']');
+        return *this;
+    }
+
+    JsonWriter& JsonWriter::key(std::string_view name) {
+        prepare_value();
+        write_string(name);
+        out_ << ": ";
+        after_key_ = true;
+        return *this;
+    }
+
+    JsonWriter& JsonWriter::value(std::string_view text) {
+        prepare_value();
+        write_string(text);
+        return *this;
+    }
+
+    JsonWriter& JsonWriter::value(bool flag) {
+        prepare_value();
+        out_ << (flag ? "true" : "false");
+        return *this;
+    }
+
+    JsonWriter& JsonWriter::value(double number) {
+        prepare_value();
+        if (std::isfinite(number)) {
+            const auto precision = out_.precision(std::numeric_limits<double>::digits10);
+            out_ << number;
+            out_.precision(precision);
+        } else {
+            out_ << "null";
+        }
+        return *this;
+    }
+
+    void JsonWriter::prepare_value() {
+        if (after_key_) {
+            after_key_ = false;
+            return;
+        }
+
+        if (!has_items_.empty()) {
+            if (has_items_.back()) {
+                out_ << ',';
+            }
+            has_items_.back() = true;
+            new_line();
+        }
+    }
+
+    void JsonWriter::open(char bracket) {
+        prepare_value();
+        out_ << bracket;
+        has_items_.push_back(false);
+    }
+
+    void JsonWriter::close(char bracket) {
+        const bool had_items = has_items_.back();
+        has_items_.pop_back();
+        if (had_items) {
+            new_line();
+        }
+        out_ << bracket;
+
+        if (has_items_.empty()) {
+            out_ << '\n';
+        }
+    }
+
+    void JsonWriter::write_string(std::string_view text) {
+        static constexpr std::string_view HexDigits = "0123456789abcdef";
+
+        out_ << '"';
+        for (const char symbol : text) {
+            switch (symbol) {
+                case '"': out_ << R"(\")"; break;
+                case '\\': out_ << R"(\\)"; break;
+                case '\n': out_ << R"(\n)"; break;
+                case '\r': out_ << R"(\r)"; break;
+                case '\t': out_ << R"(\t)"; break;
+                default:
+                    if (static_cast<unsigned char>(symbol) < 0x20) {
+                        const auto code = static_cast<unsigned char>(symbol);
+                        out_ << "\\u00" << HexDigits[code >> 4] << HexDigits[code & 0xF];
+                    } else {
+                        out_ << symbol;
+                    }
+            }
+        }
+        out_ << '"';
+    }
+
+    void JsonWriter::new_line() {
+        out_ << '\n' << std::string(has_items_.size() * 2, ' ');
+    }
+
+
+    // Recursive descent over the RFC 8259 grammar; \u escapes outside the basic plane are not combined.
+    class JsonValue::Parser {
+    public:
+        explicit Parser(std::string_view text)
+            : text_(text) {}
+
+        JsonValue document() {
+            auto result = value();
+            skip_whitespace();
+            if (position_ != text_.size()) {
+                fail("trailing characters");
+            }
+            return result;
+        }
+
+    private:
+        static constexpr std::size_t MaxDepth = 256;
+
+        JsonValue value() {
+            skip_whitespace();
+            if (position_ == text_.size()) {
+                fail("unexpected end of the document");
+            }
+
+            JsonValue result;
+            switch (text_[position_]) {
+                case '{': object(result); break;
+                case '[': array(result); break;
+                case '"':
+                    result.kind_ = Kind::STRING;
+                    result.string_ = string();
+                    break;
+                case 't':
+                    literal("true");
+                    result.kind_ = Kind::BOOLEAN;
+                    result.boolean_ = true;
+                    break;
+                case 'f':
+                    literal("false");
+                    result.kind_ = Kind::BOOLEAN;
+                    break;
+                case 'n': literal("null"); break;
+                default:
+                    number(result);
+            }
+            return result;
+        }
+
+        void object(JsonValue& result) {
+            result.kind_ = Kind::OBJECT;
+            enter();
+            position_++;  // '{'
+
+            skip_whitespace();
+            if (consume('}')) {
+                leave();
+                return;
+            }
+            do {
+                skip_whitespace();
+                if (position_ == text_.size() || text_[position_] != '"') {
+                    fail("expected a member name");
+                }
+                result.keys_.push_back(string());
+                skip_whitespace();
+                if (!consume(':')) {
+                    fail("expected ':'");
+                }
+                result.items_.push_back(value());
+                skip_whitespace();
+            } while (consume(','));
+
+            if (!consume('}')) {
+                fail("expected ',' or '}'");
+            }
+            leave();
+        }
+
+        void array(JsonValue& result) {
+            result.kind_ = Kind::ARRAY;
+            enter();
+            position_++;  // '['
+
+            skip_whitespace();
+            if (consume(']')) {
+                leave();
+                return;
+            }
+            do {
+                result.items_.push_back(value());
+                skip_whitespace();
+            } while (consume(','));
+
+            if (!consume(']')) {
+                fail("expected ',' or ']'");
+            }
+            leave();
+        }
+
+        std::string string() {
+            position_++;  // '"'
+
+            std::string result;
+            while (true) {
+                if (position_ == text_.size()) {
+                    fail("unterminated string");
+                }
+                const char symbol = text_[position_++];
+                if (symbol == '"') {
+                    return result;
+                }
+                if (static_cast<unsigned char>(symbol) < 0x20) {
+                    fail("control character in a string");
+                }
+                if (symbol != '\\') {
+                    result += symbol;
+                    continue;
+                }
+
+                if (position_ == text_.size()) {
+                    fail("unterminated string");
+                }
+                switch (const char escaped = text_[position_++]) {
+                    case '"':
+                    case '\\':
+                    case '/': result += escaped; break;
+                    case 'b': result += '\b'; break;
+                    case 'f': result += '\f'; break;
+                    case 'n': result += '\n'; break;
+                    case 'r': result += '\r'; break;
+                    case 't': result += '\t'; break;
+                    case 'u': append_utf8(result, code_unit()); break;
+                    default: fail("invalid escape sequence");
+                }
+            }
+        }
+
+        std::uint32_t code_unit() {
+            if (text_.size() - position_ < 4) {
+                fail("truncated \\u escape");
+            }
+
+            std::uint32_t code = 0;
+            for (std::size_t i = 0; i != 4; i++) {
+                const char digit = text_[position_++];
+                code <<= 4;
+                if (digit >= '0' && digit <= '9') {
+                    code |= static_cast<std::uint32_t>(digit - '0');
+                } else if (digit >= 'a' && digit <= 'f') {
+                    code |= static_cast<std::uint32_t>(digit - 'a' + 10);
+                } else if (digit >= 'A' && digit <= 'F') {
+                    code |= static_cast<std::uint32_t>(digit - 'A' + 10);
+                } else {
+                    fail("invalid \\u escape");
+                }
+            }
+            return code;
+        }
+
+        static void append_utf8(std::string& out, std::uint32_t code) {
+            if (code < 0x80) {
+                out += static_cast<char>(code);
+            } else if (code < 0x800) {
+                out += static_cast<char>(0xC0 | (code >> 6));
+                out += static_cast<char>(0x80 | (code & 0x3F));
+            } else {
+                out += static_cast<char>(0xE0 | (code >> 12));
+                out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                out += static_cast<char>(0x80 | (code & 0x3F));
+            }
+        }
+
+        // Keeps the literal besides its value, so integers beyond the 53 bits of a double can be read exactly.
+        void number(JsonValue& result) {
+            const auto begin = position_;
+            consume('-');
+            const auto digits = [this]() {
+                const auto start = position_;
+                while (position_ != text_.size() && text_[position_] >= '0' && text_[position_] <= '9') {
+                    position_++;
+                }
+                return position_ != start;
+            };
+
+            if (!digits()) {
+                fail("expected a value");
+            }
+            if (consume('.') && !digits()) {
+                fail("expected digits after the decimal point");
+            }
+            if (consume('e') || consume('E')) {
+                if (!consume('+')) {
+                    consume('-');
+                }
+                if (!digits()) {
+                    fail("expected digits in the exponent");
+                }
+            }
+
+            // strtod needs a terminated string and the view may run on into the next value
+            result.kind_ = Kind::NUMBER;
+            result.string_ = text_.substr(begin, position_ - begin);
+            result.number_ = std::strtod(result.string_.c_str(), nullptr);
+        }
+
+        void literal(std::string_view word) {
+            if (text_.substr(position_, word.size()) != word) {
+                fail("expected a value");
+            }
+            position_ += word.size();
+        }
+
+        bool consume(char symbol) {
+            if (position_ != text_.size() && text_[position_] == symbol) {
+                position_++;
+                return true;
+            }
+            return false;
+        }
+
+        void skip_whitespace() {
+            while (position_ != text_.size()
+                   && (text_[position_] == ' ' || text_[position_] == '\t' || text_[position_] == '\n'
+                       || text_[position_] == '\r')) {
+                position_++;
+            }
+        }
+
+        void enter() {
+            if (++depth_ > MaxDepth) {
+                fail("nested too deeply");
+            }
+        }
+
+        void leave() {
+            depth_--;
+        }
+
+        [[noreturn]] void fail(std::string_view what) const {
+            throw std::invalid_argument(
+                "invalid JSON at offset " + std::to_string(position_) + ": " + std::string(what)
+            );
+        }
+
+    private:
+        std::string_view text_;
+        std::size_t position_ = 0;
+        std::size_t depth_ = 0;
+    };
+
+
+    JsonValue JsonValue::parse(std::string_view text) {
+        return Parser(text).document();
+    }
+
+    bool JsonValue::as_bool() const {
+        expect(Kind::BOOLEAN);
+        return boolean_;
+    }
+
+    double JsonValue::as_number() const {
+        expect(Kind::NUMBER);
+        return number_;
+    }
+
+    std::uint64_t JsonValue::as_unsigned() const {
+        expect(Kind::NUMBER);
+        std::uint64_t value = 0;
+        const auto* const end = string_.data() + string_.size();
+        const auto [last, error] = std::from_chars(string_.data(), end, value);
+        if (error != std::errc() || last != end) {
+            throw std::invalid_argument("JSON number " + string_ + " is not an unsigned 64-bit integer");
+        }
+        return value;
+    }
+
+    const std::string& JsonValue::as_string() const {
+        expect(Kind::STRING);
+        return string_;
+    }
+
+    const std::vector<JsonValue>& JsonValue::items() const {
+        if (kind_ != Kind::ARRAY) {
+            expect(Kind::OBJECT);
+        }
+        return items_;
+    }
+
+    const JsonValue* JsonValue::find(std::string_view key) const {
+        expect(Kind::OBJECT);
+        const auto found = std::find(keys_.cbegin(), keys_.cend(), key);
+        return found == keys_.cend() ? nullptr : &items_[static_cast<std::size_t>(found - keys_.cbegin())];
+    }
+
+    const JsonValue& JsonValue::at(std::string_view key) const {
+        const auto* const member = find(key);
+        if (member == nullptr) {
+            throw std::invalid_argument("missing JSON member '" + std::string(key) + "'");
+        }
+        return *member;
+    }
+
+    void JsonValue::expect(Kind kind) const {
+        static constexpr std::array<std::string_view, 6> Names{
+            "null", "a boolean", "a number", "a string", "an array", "an object",
+        };
+        if (kind_ != kind) {
+            throw std::invalid_argument(
+                "expected " + std::string(Names[static_cast<std::size_t>(kind)]) + " in JSON, found "
+                + std::string(Names[static_cast<std::size_t>(kind_)])
+            );
+        }
+    }
+}  // namespace core
@@ -0,0 +1,211 @@
+#include <common/numbers.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+
+namespace io {
+    namespace {
+#if defined(__AVX2__)
+        constexpr std::size_t BlockSize = 32;
+#else
+        constexpr std::size_t BlockSize = 16;
+#endif
+
+#ifdef _MSC_VER
+#define AOC_FORCE_INLINE __forceinline
+#else
+#define AOC_FORCE_INLINE inline __attribute__((always_inline))
+#endif
+
+        using Mask = std::uint32_t;
+        constexpr Mask FullMask = static_cast<Mask>((std::uint64_t{1} << BlockSize) - 1);
+
+        // One bit per byte of a block for each character class the parser cares about.
+        struct Classes {
+            Mask digits = 0;
+            Mask blanks = 0;
+            Mask minus = 0;
+        };
+
+        // the classifier is tiny but compilers tend to keep it out of line, which costs more than the work itself
+        AOC_FORCE_INLINE Classes classify(const char* block) noexcept {
+#if defined(__AVX2__)
+            const auto bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+            const auto digits = _mm256_and_si256(
+                _mm256_cmpgt_epi8(bytes, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), bytes)
+            );
+            const auto blanks = _mm256_or_si256(
+                _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\t'))
+            );
+            const auto minus = _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('-'));
+            return {
+                static_cast<Mask>(_mm256_movemask_epi8(digits)),
+                static_cast<Mask>(_mm256_movemask_epi8(blanks)),
+                static_cast<Mask>(_mm256_movemask_epi8(minus)),
+            };
+#elif defined(__SSE2__) || defined(_M_X64)
+            const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+            const auto digits = _mm_and_si128(
+                _mm_cmpgt_epi8(bytes, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(bytes, _mm_set1_epi8('9' + 1))
+            );
+            const auto blanks =
+                _mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\t')));
+            const auto minus = _mm_cmpeq_epi8(bytes, _mm_set1_epi8('-'));
+            return {
+                static_cast<Mask>(_mm_movemask_epi8(digits)),
+                static_cast<Mask>(_mm_movemask_epi8(blanks)),
+                static_cast<Mask>(_mm_movemask_epi8(minus)),
+            };
+#else
+            Classes classes;
+            for (std::size_t i = 0; i != BlockSize; i++) {
+                const auto bit = Mask{1} << i;
+                classes.digits |= detail::is_digit(block[i]) ? bit : 0;
+                classes.blanks |= block[i] == ' ' || block[i] == '\t' ? bit : 0;
+                classes.minus |= block[i] == '-' ? bit : 0;
+            }
+            return classes;
+#endif
+        }
+
+        // Digits among the `count` (< BlockSize) bytes from `first`, bit i for first[i]. The mask is built a byte at
+        // a time rather than by loading a whole block, which would read past the text.
+        Mask tail_digits(const char* first, std::size_t count) noexcept {
+            Mask digits = 0;
+            for (std::size_t i = 0; i != count; i++) {
+                digits |= Mask{detail::is_digit(first[i])} << i;
+            }
+            return digits;
+        }
+
+        // The same for the `count` (< BlockSize) bytes in front of `last`, bit i for last[i - count].
+        Mask head_digits(const char* last, std::size_t count) noexcept {
+            return tail_digits(last - count, count);
+        }
+
+        // Walks the tokens of `line` block by block and hands every converted value to `emit`. Each token start
+        // costs one bit-scan: its length is the distance to the next separator bit of the same block.
+        template<typename T, typename Emit>
+        void scan(std::string_view line, Emit&& emit) {
+            const char* const begin = line.data();
+            char tail[BlockSize];
+
+            const char* open = nullptr;  // token running past the end of the previous block
+            Mask carry = 0;              // whether the last byte of the previous block belonged to a token
+            for (std::size_t offset = 0; offset < line.size(); offset += BlockSize) {
+                const char* block = begin + offset;
+                const auto available = std::min(BlockSize, line.size() - offset);
+                if (available != BlockSize) {
+                    // padding with blanks also closes a token that runs up to the end of the line
+                    std::memset(tail, ' ', BlockSize);
+                    std::memcpy(tail, block, available);
+                    block = tail;
+                }
+
+                auto [digits, blanks, minus] = classify(block);
+                if constexpr (!std::is_signed_v<T>) {
+                    minus = 0;
+                }
+
+                const Mask tokens = digits | minus;
+                const Mask previous = ((tokens << 1) | carry) & FullMask;
+                if ((tokens | blanks) != FullMask || (minus & previous) != 0) {
+                    throw std::invalid_argument("Invalid conversion to integer.");
+                }
+
+                const char* const base = begin + offset;
+                const Mask separators = ~tokens;
+                if (open != nullptr) {
+                    const auto length = static_cast<std::size_t>(std::countr_zero(separators));
+                    if (length < BlockSize) {
+                        emit(detail::convert<T>(open, base + length, begin));
+                        open = nullptr;
+                    }
+                }
+
+                for (auto starts = tokens & ~previous; starts != 0; starts &= starts - 1) {
+                    const auto position = static_cast<std::size_t>(std::countr_zero(starts));
+                    const auto length = static_cast<std::size_t>(std::countr_zero(separators >> position));
+                    if (position + length < BlockSize) {
+                        emit(detail::convert<T>(base + position, base + position + length, begin));
+                    } else {
+                        open = base + position;
+                    }
+                }
+                carry = (tokens >> (BlockSize - 1)) & 1;
+            }
+
+            if (open != nullptr) {
+                emit(detail::convert<T>(open, begin + line.size(), begin));
+            }
+        }
+    }  // namespace
+
+
+    template<typename T, typename Allocator>
+    std::size_t parse_integers(std::string_view line, std::vector<T, Allocator>& out) {
+        const auto before = out.size();
+        scan<T>(line, [&out](T value) { out.push_back(value); });
+        return out.size() - before;
+    }
+
+    template<typename T>
+    std::size_t parse_integers(std::string_view line, std::span<T> out) {
+        std::size_t count = 0;
+        scan<T>(line, [&out, &count](T value) {
+            if (count == out.size()) {
+                throw std::invalid_argument("Too many values in the line.");
+            }
+            out[count++] = value;
+        });
+        return count;
+    }
+
+#define AOC_DEFINE_PARSE_INTEGERS(T)                                                          \
+    template std::size_t parse_integers(std::string_view line, std::vector<T>& out);      \
+    template std::size_t parse_integers(std::string_view line, std::pmr::vector<T>& out); \
+    template std::size_t parse_integers<T>(std::string_view line, std::span<T> out);
+
+    AOC_DEFINE_PARSE_INTEGERS(int)
+    AOC_DEFINE_PARSE_INTEGERS(unsigned)
+    AOC_DEFINE_PARSE_INTEGERS(long)
+    AOC_DEFINE_PARSE_INTEGERS(unsigned long)
+    AOC_DEFINE_PARSE_INTEGERS(long long)
+    AOC_DEFINE_PARSE_INTEGERS(unsigned long long)
+
+#undef AOC_DEFINE_PARSE_INTEGERS
+
+
+    std::size_t find_first_digit(std::string_view text) noexcept {
+        std::size_t offset = 0;
+        for (; offset + BlockSize <= text.size(); offset += BlockSize) {
+            if (const auto digits = classify(text.data() + offset).digits; digits != 0) {
+                return offset + static_cast<std::size_t>(std::countr_zero(digits));
+            }
+        }
+
+        const auto digits = tail_digits(text.data() + offset, text.size() - offset);
+        return digits != 0 ? offset + static_cast<std::size_t>(std::countr_zero(digits)) : std::string_view::npos;
+    }
+
+    std::size_t find_last_digit(std::string_view text) noexcept {
+        std::size_t end = text.size();
+        for (; end >= BlockSize; end -= BlockSize) {
+            if (const auto digits = classify(text.data() + end - BlockSize).digits; digits != 0) {
+                return end - BlockSize + static_cast<std::size_t>(std::bit_width(digits)) - 1;
+            }
+        }
+
+        const auto digits = head_digits(text.data() + end, end);
+        return digits != 0 ? static_cast<std::size_t>(std::bit_width(digits)) - 1 : std::string_view::npos;
+    }
+
+#undef AOC_FORCE_INLINE
+}  // namespace io
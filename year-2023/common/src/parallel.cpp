@@ -0,0 +1,66 @@
+#include <common/parallel.hpp>
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include <common/thread_pool.hpp>
+
+
+namespace core {
+    namespace detail {
+        namespace {
+            // One pool for every call, started by the first one that needs it: a parse must not pay for starting
+            // threads, and concurrent calls must not multiply them.
+            ThreadPool& shared_pool() {
+                static ThreadPool pool(std::thread::hardware_concurrency());
+                return pool;
+            }
+        }  // namespace
+
+        void run_chunks(std::size_t count, const std::function<void(std::size_t)>& task) {
+            // a worker of the runner or the daemon already shares the machine with the other workers
+            if (count <= 1 || std::thread::hardware_concurrency() <= 1 || ThreadPool::in_worker()) {
+                for (std::size_t index = 0; index != count; index++) {
+                    task(index);
+                }
+                return;
+            }
+
+            // the shared pool may run tasks of other calls too, so this call waits for its own tasks only
+            std::mutex mutex;
+            std::condition_variable finished;
+            std::size_t remaining = count;
+            std::exception_ptr error;
+            auto& pool = shared_pool();
+            for (std::size_t index = 0; index != count; index++) {
+                pool.submit([&, index]() {
+                    std::exception_ptr task_error;
+                    try {
+                        task(index);
+                    } catch (...) {
+                        task_error = std::current_exception();
+                    }
+
+                    // notified under the lock, which the caller needs before it can return and destroy `finished`
+                    const std::lock_guard lock(mutex);
+                    if (task_error && !error) {
+                        error = std::move(task_error);
+                    }
+                    if (--remaining == 0) {
+                        finished.notify_one();
+                    }
+                });
+            }
+
+            std::unique_lock lock(mutex);
+            finished.wait(lock, [&remaining]() { return remaining == 0; });
+
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }  // namespace detail
+}  // namespace core
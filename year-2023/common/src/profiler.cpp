@@ -0,0 +1,319 @@
+#include <common/profiler.hpp>
+
+#include <algorithm>
+#include <iomanip>
+#include <utility>
+
+#include <common/timing.hpp>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+
+namespace core {
+    namespace {
+        thread_local Profiler* current_profiler = nullptr;
+
+        using CounterField = std::optional<std::uint64_t> CounterValues::*;
+
+        constexpr std::array<CounterField, 4> CounterFields{
+            &CounterValues::cycles,
+            &CounterValues::instructions,
+            &CounterValues::cache_misses,
+            &CounterValues::branch_misses,
+        };
+
+        constexpr std::array<std::string_view, 4> CounterNames{
+            "cycles",
+            "instructions",
+            "cache_misses",
+            "branch_misses",
+        };
+
+#ifdef __linux__
+        constexpr std::array<std::uint64_t, 4> CounterEvents{
+            PERF_COUNT_HW_CPU_CYCLES,
+            PERF_COUNT_HW_INSTRUCTIONS,
+            PERF_COUNT_HW_CACHE_MISSES,
+            PERF_COUNT_HW_BRANCH_MISSES,
+        };
+
+        int open_event(std::uint64_t event, int leader) noexcept {
+            perf_event_attr attributes{};
+            attributes.size = sizeof(attributes);
+            attributes.type = PERF_TYPE_HARDWARE;
+            attributes.config = event;
+            attributes.disabled = leader == -1 ? 1 : 0;  // the whole group starts with its leader
+            attributes.exclude_kernel = 1;
+            attributes.exclude_hv = 1;
+            attributes.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID;
+
+            return static_cast<int>(::syscall(SYS_perf_event_open, &attributes, 0, -1, leader, PERF_FLAG_FD_CLOEXEC));
+        }
+#endif
+
+        double to_ms(std::chrono::nanoseconds duration) {
+            return std::chrono::duration<double, std::milli>(duration).count();
+        }
+
+        double to_kib(std::uint64_t bytes) {
+            return static_cast<double>(bytes) / 1024;
+        }
+    }  // namespace
+
+
+    CounterValues CounterValues::operator-(const CounterValues& other) const noexcept {
+        CounterValues difference;
+        for (const auto field : CounterFields) {
+            if ((this->*field) && (other.*field)) {
+                difference.*field = *(this->*field) - *(other.*field);
+            }
+        }
+        return difference;
+    }
+
+
+    HardwareCounters::HardwareCounters() noexcept {
+#ifdef __linux__
+        for (std::size_t i = 0; i != EventCount; i++) {
+            descriptors_[i] = open_event(CounterEvents[i], leader_);
+            if (leader_ == -1) {
+                // without cycles (the leader) there is no group to attach the rest to
+                if (descriptors_[i] == -1) {
+                    return;
+                }
+                leader_ = descriptors_[i];
+            }
+        }
+
+        ::ioctl(leader_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ::ioctl(leader_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+    }
+
+    HardwareCounters::~HardwareCounters() {
+#ifdef __linux__
+        for (const auto descriptor : descriptors_) {
+            if (descriptor != -1) {
+                ::close(descriptor);
+            }
+        }
+#endif
+    }
+
+    CounterValues HardwareCounters::read() const noexcept {
+        CounterValues values;
+#ifdef __linux__
+        if (leader_ == -1) {
+            return values;
+        }
+
+        // PERF_FORMAT_GROUP | PERF_FORMAT_ID: { nr, { value, id } * nr }
+        std::array<std::uint64_t, 1 + 2 * EventCount> buffer{};
+        if (::read(leader_, buffer.data(), sizeof(buffer)) <= 0) {
+            return values;
+        }
+
+        std::array<std::uint64_t, EventCount> ids{};
+        for (std::size_t i = 0; i != EventCount; i++) {
+            if (descriptors_[i] == -1 || ::ioctl(descriptors_[i], PERF_EVENT_IOC_ID, &ids[i]) != 0) {
+                ids[i] = ~std::uint64_t{0};
+            }
+        }
+
+        const auto count = std::min<std::uint64_t>(buffer[0], EventCount);
+        for (std::size_t entry = 0; entry != count; entry++) {
+            const auto value = buffer[1 + 2 * entry];
+            const auto id = buffer[2 + 2 * entry];
+            for (std::size_t i = 0; i != EventCount; i++) {
+                if (ids[i] == id) {
+                    values.*CounterFields[i] = value;
+                }
+            }
+        }
+#endif
+        return values;
+    }
+
+
+    Profiler::Profiler(bool with_counters)
+        : previous_(std::exchange(current_profiler, this)) {
+        if (with_counters) {
+            counters_.emplace();
+        }
+    }
+
+    Profiler::~Profiler() {
+        current_profiler = previous_;
+    }
+
+    Profiler* Profiler::current() noexcept {
+        return current_profiler;
+    }
+
+    std::size_t Profiler::begin_phase(std::string_view name) {
+        records_.push_back(PhaseRecord{
+            .name = std::string(name),
+            .depth = depth_++,
+            .wall = {},
+            .cpu = {},
+            .counters = std::nullopt,
+            .allocations = std::nullopt,
+        });
+        started_.push_back(sample_counters());
+        if (allocation_tracking()) {
+            // the bookkeeping allocates too, so the sample is taken once it is in place
+            allocations_started_.emplace_back();
+            enclosing_peaks_.push_back(reset_allocation_peak());
+            allocations_started_.back() = allocation_counters();
+        }
+        return records_.size() - 1;
+    }
+
+    void Profiler::end_phase(std::size_t index, std::chrono::nanoseconds wall, std::chrono::nanoseconds cpu) {
+        const auto allocations = allocation_counters();
+
+        auto& record = records_[index];
+        record.wall = wall;
+        record.cpu = cpu;
+        if (const auto now = sample_counters(); now && started_[index]) {
+            record.counters = *now - *started_[index];
+        }
+        if (allocation_tracking()) {
+            const auto& started = allocations_started_[index];
+            record.allocations = AllocationStats{
+                .count = allocations.count - started.count,
+                .bytes = allocations.bytes - started.bytes,
+                .peak_bytes = allocations.peak_bytes,
+            };
+
+            // phases end in reverse order, so the last saved peak belongs to the phase around this one
+            restore_allocation_peak(enclosing_peaks_.back());
+            enclosing_peaks_.pop_back();
+        }
+        depth_--;
+    }
+
+    std::optional<CounterValues> Profiler::sample_counters() const noexcept {
+        if (!counters_available()) {
+            return std::nullopt;
+        }
+        return counters_->read();
+    }
+
+    void Profiler::print(std::ostream& out) const {
+        const auto flags = out.flags();
+        const auto precision = out.precision();
+
+        out << std::left << std::setw(24) << "phase" << std::right << std::setw(12) << "wall ms" << std::setw(12)
+            << "cpu ms";
+        if (counters_available()) {
+            out << std::setw(16) << "cycles" << std::setw(16) << "instructions" << std::setw(8) << "ipc"
+                << std::setw(14) << "cache misses" << std::setw(14) << "branch misses";
+        }
+        if (allocation_tracking()) {
+            out << std::setw(12) << "allocs" << std::setw(14) << "alloc KiB" << std::setw(12) << "peak KiB";
+        }
+        out << '\n';
+
+        const auto print_count = [&out](int width, const std::optional<std::uint64_t>& count) {
+            out << std::setw(width);
+            if (count) {
+                out << *count;
+            } else {
+                out << '-';
+            }
+        };
+
+        out << std::fixed << std::setprecision(3);
+        for (const auto& record : records_) {
+            out << std::left << std::setw(24) << (std::string(2 * record.depth, ' ') + record.name) << std::right
+                << std::setw(12) << to_ms(record.wall) << std::setw(12) << to_ms(record.cpu);
+
+            if (record.counters) {
+                const auto& counters = *record.counters;
+                print_count(16, counters.cycles);
+                print_count(16, counters.instructions);
+
+                out << std::setw(8);
+                if (counters.cycles && counters.instructions && *counters.cycles != 0) {
+                    out << std::setprecision(2)
+                        << static_cast<double>(*counters.instructions) / static_cast<double>(*counters.cycles)
+                        << std::setprecision(3);
+                } else {
+                    out << '-';
+                }
+
+                print_count(14, counters.cache_misses);
+                print_count(14, counters.branch_misses);
+            } else if (counters_available()) {
+                out << std::setw(16 + 16 + 8 + 14 + 14) << "";
+            }
+
+            if (record.allocations) {
+                const auto& allocations = *record.allocations;
+                out << std::setw(12) << allocations.count << std::setw(14) << to_kib(allocations.bytes)
+                    << std::setw(12) << to_kib(allocations.peak_bytes);
+            }
+            out << '\n';
+        }
+
+        if (counters_ && !counters_->available()) {
+            out << "(hardware counters are not available on this system)\n";
+        }
+
+        out.flags(flags);
+        out.precision(precision);
+    }
+
+    void Profiler::write_json(JsonWriter& json) const {
+        json.begin_array();
+        for (const auto& record : records_) {
+            json.begin_object();
+            json.field("name", record.name);
+            json.field("depth", record.depth);
+            json.field("wall_ns", record.wall.count());
+            json.field("cpu_ns", record.cpu.count());
+            if (record.counters) {
+                json.key("counters").begin_object();
+                for (std::size_t i = 0; i != CounterFields.size(); i++) {
+                    if (const auto& value = (*record.counters).*CounterFields[i]) {
+                        json.field(CounterNames[i], *value);
+                    }
+                }
+                json.end_object();
+            }
+            if (record.allocations) {
+                json.key("allocations").begin_object();
+                json.field("count", record.allocations->count);
+                json.field("bytes", record.allocations->bytes);
+                json.field("peak_bytes", record.allocations->peak_bytes);
+                json.end_object();
+            }
+            json.end_object();
+        }
+        json.end_array();
+    }
+
+
+    ScopedPhase::ScopedPhase(std::string_view name)
+        : profiler_(current_profiler) {
+        if (profiler_ != nullptr) {
+            index_ = profiler_->begin_phase(name);
+            cpu_start_ = thread_cpu_time();
+            wall_start_ = std::chrono::steady_clock::now();
+        }
+    }
+
+    ScopedPhase::~ScopedPhase() {
+        if (profiler_ != nullptr) {
+            const auto wall = std::chrono::steady_clock::now() - wall_start_;
+            const auto cpu = thread_cpu_time() - cpu_start_;
+            profiler_->end_phase(index_, std::chrono::duration_cast<std::chrono::nanoseconds>(wall), cpu);
+        }
+    }
+}  // namespace core
@@ -0,0 +1,306 @@
+#include <common/puzzle.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <common/cache.hpp>
+#include <common/io.hpp>
+#include <common/json.hpp>
+#include <common/profiler.hpp>
+#include <common/snapshot.hpp>
+#include <common/stats.hpp>
+
+
+namespace aoc {
+    namespace {
+        enum class ProfileMode { OFF, TEXT, JSON };
+
+        ProfileMode profile_mode() {
+            const char* value = std::getenv("AOC_PROFILE");
+            if (value == nullptr || *value == '\0' || std::string_view(value) == "0") {
+                return ProfileMode::OFF;
+            }
+            return std::string_view(value) == "json" ? ProfileMode::JSON : ProfileMode::TEXT;
+        }
+
+        struct Options {
+            std::filesystem::path input = "input.txt";  // "-" reads stdin
+            std::optional<Part> part;
+            std::size_t warmup = 0;
+            std::size_t repeat = 1;
+            bool cache = true;
+            std::optional<std::filesystem::path> snapshot;       // parsed state to load instead of the input
+            std::optional<std::filesystem::path> save_snapshot;  // where to save the parsed state of the input
+        };
+
+        void print_usage(std::string_view program) {
+            std::cerr << "usage: " << program
+                      << " [--part 1|2] [--warmup <runs>] [--repeat <runs>] [--no-cache]"
+                         " [--snapshot <file> | --save-snapshot <file>] [<input>|-]\n"
+                      << "  --part    part to solve (default: the part the day answers)\n"
+                      << "  --warmup  unmeasured runs before the measured ones (default: 0)\n"
+                      << "  --repeat  measured runs, timings are reported when there is more than one (default: 1)\n"
+                      << "  --no-cache  always solve, even when the answer for this input is cached\n"
+                      << "  --snapshot  start from a snapshot of the parsed input instead of the input itself\n"
+                      << "  --save-snapshot  save the parsed input as a snapshot before solving\n"
+                      << "  input     puzzle input, '-' for stdin (default: input.txt)" << std::endl;
+        }
+
+        Options parse_options(int argc, char** argv) {
+            Options options;
+
+            const std::vector<std::string_view> args(argv + 1, argv + argc);
+            const auto next_value = [&args](std::size_t& i) {
+                if (i + 1 == args.size()) {
+                    throw std::invalid_argument("missing value for '" + std::string(args[i]) + "'");
+                }
+                return args[++i];
+            };
+
+            bool has_input = false;
+            for (std::size_t i = 0; i != args.size(); i++) {
+                const auto arg = args[i];
+                if (arg == "--part") {
+                    auto value = next_value(i);
+                    const auto part = io::read<int>(value);
+                    if (part != 1 && part != 2) {
+                        throw std::invalid_argument("part must be 1 or 2");
+                    }
+                    options.part = static_cast<Part>(part);
+                } else if (arg == "--warmup") {
+                    auto value = next_value(i);
+                    options.warmup = io::read<std::size_t>(value);
+                } else if (arg == "--repeat") {
+                    auto value = next_value(i);
+                    options.repeat = io::read<std::size_t>(value);
+                    if (options.repeat == 0) {
+                        throw std::invalid_argument("--repeat needs at least one run");
+                    }
+                } else if (arg == "--no-cache") {
+                    options.cache = false;
+                } else if (arg == "--snapshot") {
+                    options.snapshot = next_value(i);
+                } else if (arg == "--save-snapshot") {
+                    options.save_snapshot = next_value(i);
+                } else if (arg.starts_with("--") || std::exchange(has_input, true)) {
+                    throw std::invalid_argument("unexpected argument '" + std::string(arg) + "'");
+                } else {
+                    options.input = arg;
+                }
+            }
+
+            if (options.snapshot && (has_input || options.save_snapshot)) {
+                throw std::invalid_argument("--snapshot replaces the input, it cannot be combined with one");
+            }
+
+            return options;
+        }
+
+        double elapsed_ns(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to) {
+            return std::chrono::duration<double, std::nano>(to - from).count();
+        }
+
+        // Per-phase samples (in nanoseconds) of the measured runs.
+        struct Timings {
+            std::vector<double> parse;
+            std::vector<double> solve;
+            std::vector<double> total;
+        };
+
+        SnapshotSolution& snapshot_support(Solution& solution) {
+            auto* const support = dynamic_cast<SnapshotSolution*>(&solution);
+            if (support == nullptr) {
+                throw std::invalid_argument("this day does not support snapshots");
+            }
+            return *support;
+        }
+
+        void save_snapshot(const Puzzle& puzzle, std::string_view document, const std::filesystem::path& path) {
+            const auto solution = puzzle.create();
+            solution->parse(document);
+
+            io::SnapshotWriter out;
+            snapshot_support(*solution).save(out);
+            out.write(path, puzzle.day, puzzle.version);
+        }
+
+        void check_snapshot(const Puzzle& puzzle, const io::Snapshot& snapshot) {
+            if (snapshot.day() != puzzle.day || snapshot.version() != puzzle.version) {
+                throw std::invalid_argument(
+                    "the snapshot is of day " + std::to_string(snapshot.day()) + " version "
+                    + std::to_string(snapshot.version()) + ", not of day " + std::to_string(puzzle.day) + " version "
+                    + std::to_string(puzzle.version)
+                );
+            }
+        }
+
+        // Solves `warmup + repeat` times from scratch, recording the timings of the measured runs. Every run parses
+        // `document`, or loads `snapshot` when there is one.
+        Answer run_solver(
+            const Puzzle& puzzle, Part part, std::string_view document, const io::Snapshot* snapshot,
+            const Options& options, Timings& timings
+        ) {
+            std::optional<Answer> result;
+            for (std::size_t run = 0; run != options.warmup + options.repeat; run++) {
+                const auto start = std::chrono::steady_clock::now();
+                const auto solution = puzzle.create();
+                {
+                    const core::ScopedPhase phase("parse");
+                    if (snapshot != nullptr) {
+                        snapshot_support(*solution).load(*snapshot);
+                    } else {
+                        solution->parse(document);
+                    }
+                }
+                const auto parsed = std::chrono::steady_clock::now();
+                const auto answer = [&] {
+                    const core::ScopedPhase phase("solve");
+                    return solution->solve(part);
+                }();
+                const auto solved = std::chrono::steady_clock::now();
+
+                if (result && *result != answer) {
+                    throw std::runtime_error("the answer changed between runs");
+                }
+                result = answer;
+
+                if (run >= options.warmup) {
+                    timings.parse.push_back(elapsed_ns(start, parsed));
+                    timings.solve.push_back(elapsed_ns(parsed, solved));
+                    timings.total.push_back(elapsed_ns(start, solved));
+                }
+            }
+            return *result;
+        }
+
+        void print_timings(std::ostream& out, const Timings& timings) {
+            const auto flags = out.flags();
+            const auto precision = out.precision();
+
+            out << std::left << std::setw(8) << "phase" << std::right << std::setw(8) << "runs" << std::setw(12)
+                << "min ms" << std::setw(12) << "median ms" << std::setw(12) << "mean ms" << std::setw(12)
+                << "stddev ms" << '\n';
+
+            const auto print_phase = [&out](std::string_view name, const std::vector<double>& samples) {
+                constexpr double NsPerMs = 1e6;
+
+                const auto summary = core::summarize(samples);
+                out << std::left << std::setw(8) << name << std::right << std::setw(8) << summary.count
+                    << std::setw(12) << summary.min / NsPerMs << std::setw(12) << summary.median / NsPerMs
+                    << std::setw(12) << summary.mean / NsPerMs << std::setw(12) << summary.stddev / NsPerMs << '\n';
+            };
+
+            out << std::fixed << std::setprecision(3);
+            print_phase("parse", timings.parse);
+            print_phase("solve", timings.solve);
+            print_phase("total", timings.total);
+
+            out.flags(flags);
+            out.precision(precision);
+        }
+    }  // namespace
+
+
+    UnsolvedPart::UnsolvedPart(Part part)
+        : std::invalid_argument("part " + std::to_string(static_cast<int>(part)) + " is not solved") {}
+
+    int solve_puzzle(const Puzzle& puzzle, int argc, char** argv) {
+        Options options;
+        try {
+            options = parse_options(argc, argv);
+        } catch (const std::exception& error) {
+            std::cerr << error.what() << std::endl;
+            print_usage(argc > 0 ? argv[0] : puzzle.name);
+            return EXIT_FAILURE;
+        }
+
+        const auto mode = profile_mode();
+        std::optional<core::Profiler> profiler;
+        if (mode != ProfileMode::OFF) {
+            profiler.emplace(true);
+        }
+
+        Timings timings;
+        try {
+            // stdin can only be read once, so it is kept in memory for every run
+            std::optional<io::MappedFile> file;
+            std::string piped;
+            std::optional<io::Snapshot> snapshot;
+            {
+                const core::ScopedPhase phase("load");
+                if (options.snapshot) {
+                    snapshot.emplace(*options.snapshot);
+                    check_snapshot(puzzle, *snapshot);
+                } else if (options.input == "-") {
+                    piped = io::read_stream(stdin);
+                } else {
+                    file.emplace(options.input);
+                }
+            }
+            const std::string_view document = file ? file->view() : std::string_view(piped);
+
+            const auto part = options.part.value_or(puzzle.part);
+
+            if (options.save_snapshot) {
+                const core::ScopedPhase phase("snapshot");
+                save_snapshot(puzzle, document, *options.save_snapshot);
+            }
+
+            // measuring and profiling are about the solver, only a plain run may take the answer from the cache
+            std::optional<ResultCache> cache;
+            std::optional<ResultCache::Key> key;
+            std::optional<Answer> result;
+            if (options.cache && !snapshot && options.warmup == 0 && options.repeat == 1 && mode == ProfileMode::OFF) {
+                key = ResultCache::make_key(puzzle, part, document);
+                if (key) {
+                    cache.emplace();
+                    result = cache->find(*key);
+                }
+            }
+
+            if (!result) {
+                result = run_solver(puzzle, part, document, snapshot ? &*snapshot : nullptr, options, timings);
+                if (cache) {
+                    cache->store(*key, *result);
+                }
+            }
+
+            const core::ScopedPhase phase("output");
+            std::cout << "The result value is " << *result << std::endl;
+        } catch (const std::exception& error) {
+            std::cerr << puzzle.name << ": " << error.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        if (options.repeat > 1) {
+            print_timings(std::cerr, timings);
+        }
+
+        if (mode == ProfileMode::TEXT) {
+            profiler->print(std::cerr);
+        } else if (mode == ProfileMode::JSON) {
+            core::JsonWriter json(std::cerr);
+            json.begin_object();
+            json.field("day", puzzle.day);
+            json.field("name", puzzle.name);
+            json.field("counters", profiler->counters_available());
+            json.key("phases");
+            profiler->write_json(json);
+            json.end_object();
+        }
+
+        return EXIT_SUCCESS;
+    }
+}  // namespace aoc
@@ -0,0 +1,135 @@
+#include <common/snapshot.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+
+namespace io {
+    namespace {
+        constexpr std::array<char, 8> Magic{'A', 'O', 'C', 'S', 'N', 'A', 'P', '\0'};
+        constexpr std::uint32_t ByteOrderMark = 0x01020304;  // reads back differently on a host of the other order
+        constexpr std::uint32_t FormatVersion = 1;
+        constexpr std::uint64_t SectionAlignment = 64;
+
+        struct Header {
+            std::array<char, 8> magic = Magic;
+            std::uint32_t byte_order = ByteOrderMark;
+            std::uint32_t format = FormatVersion;
+            std::uint32_t day = 0;
+            std::uint32_t version = 0;
+            std::uint32_t sections = 0;
+            std::uint32_t reserved = 0;
+        };
+
+        // the section table follows the header
+        struct SectionEntry {
+            std::uint64_t offset = 0;  // from the start of the file
+            std::uint64_t count = 0;
+            std::uint32_t element_size = 0;
+            std::uint32_t alignment = 0;
+        };
+
+        std::uint64_t align_up(std::uint64_t offset) noexcept {
+            return (offset + SectionAlignment - 1) / SectionAlignment * SectionAlignment;
+        }
+
+        [[noreturn]] void throw_invalid(std::string_view what) {
+            throw std::invalid_argument("invalid snapshot: " + std::string(what));
+        }
+    }  // namespace
+
+
+    void SnapshotWriter::write(const std::filesystem::path& path, std::uint32_t day, std::uint32_t version) const {
+        const Header header{.day = day, .version = version, .sections = static_cast<std::uint32_t>(sections_.size())};
+
+        std::vector<SectionEntry> table;
+        auto offset = sizeof(Header) + sections_.size() * sizeof(SectionEntry);
+        for (const auto& section : sections_) {
+            offset = align_up(offset);
+            table.push_back(SectionEntry{
+                .offset = offset,
+                .count = section.count,
+                .element_size = section.element_size,
+                .alignment = section.alignment,
+            });
+            offset += section.bytes.size();
+        }
+
+        const auto table_size = table.size() * sizeof(SectionEntry);
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(table.data()), static_cast<std::streamsize>(table_size));
+
+        constexpr std::array<char, SectionAlignment> Padding{};
+        auto position = sizeof(Header) + table_size;
+        for (std::size_t i = 0; i != sections_.size(); i++) {
+            out.write(Padding.data(), static_cast<std::streamsize>(table[i].offset - position));
+            const auto& section = sections_[i].bytes;
+            out.write(reinterpret_cast<const char*>(section.data()), static_cast<std::streamsize>(section.size()));
+            position = table[i].offset + section.size();
+        }
+
+        if (!out.flush()) {
+            throw std::runtime_error("unable to write snapshot '" + path.string() + "'");
+        }
+    }
+
+
+    Snapshot::Snapshot(const std::filesystem::path& path)
+        : file_(path) {
+        const auto bytes = file_.view();
+
+        Header header;
+        if (bytes.size() < sizeof(header)) {
+            throw_invalid("the file is too short");
+        }
+        std::memcpy(&header, bytes.data(), sizeof(header));
+
+        if (header.magic != Magic) {
+            throw_invalid("not a snapshot file");
+        }
+        if (header.byte_order != ByteOrderMark) {
+            throw_invalid("written on a host of another byte order");
+        }
+        if (header.format != FormatVersion) {
+            throw_invalid("format version " + std::to_string(header.format) + " is not supported");
+        }
+        if ((bytes.size() - sizeof(header)) / sizeof(SectionEntry) < header.sections) {
+            throw_invalid("the section table is truncated");
+        }
+
+        day_ = header.day;
+        version_ = header.version;
+        sections_ = header.sections;
+    }
+
+    std::pair<const char*, std::size_t> Snapshot::locate(
+        std::size_t index, std::size_t element_size, std::size_t alignment
+    ) const {
+        if (index >= sections_) {
+            throw_invalid("section " + std::to_string(index) + " is missing");
+        }
+
+        const auto bytes = file_.view();
+        SectionEntry entry;
+        std::memcpy(&entry, bytes.data() + sizeof(Header) + index * sizeof(SectionEntry), sizeof(entry));
+
+        if (entry.element_size != element_size || entry.alignment != alignment) {
+            throw_invalid("section " + std::to_string(index) + " holds elements of another type");
+        }
+        if (entry.offset > bytes.size() || (bytes.size() - entry.offset) / element_size < entry.count) {
+            throw_invalid("section " + std::to_string(index) + " runs past the end of the file");
+        }
+
+        const char* const data = bytes.data() + entry.offset;
+        if (reinterpret_cast<std::uintptr_t>(data) % alignment != 0) {
+            throw_invalid("section " + std::to_string(index) + " is misaligned");
+        }
+        return {data, static_cast<std::size_t>(entry.count)};
+    }
+}  // namespace io
@@ -0,0 +1,100 @@
+#include <common/stats.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <utility>
+
+
+namespace core {
+    double percentile(const std::vector<double>& sorted, double fraction) {
+        if (sorted.empty()) {
+            return 0;
+        }
+
+        const auto rank = static_cast<std::size_t>(std::ceil(fraction * static_cast<double>(sorted.size())));
+        return sorted[std::clamp<std::size_t>(rank, 1, sorted.size()) - 1];
+    }
+
+    Summary summarize(std::vector<double> samples) {
+        Summary summary;
+        if (samples.empty()) {
+            return summary;
+        }
+
+        std::sort(samples.begin(), samples.end());
+
+        const auto count = static_cast<double>(samples.size());
+        summary.count = samples.size();
+        summary.min = samples.front();
+        summary.max = samples.back();
+        summary.mean = std::accumulate(samples.cbegin(), samples.cend(), 0.0) / count;
+
+        const auto middle = samples.size() / 2;
+        summary.median = samples.size() % 2 != 0 ? samples[middle] : (samples[middle - 1] + samples[middle]) / 2;
+        summary.p99 = percentile(samples, 0.99);
+
+        if (samples.size() > 1) {
+            const auto squares = std::accumulate(samples.cbegin(), samples.cend(), 0.0, [&summary](double sum, double x) {
+                return sum + (x - summary.mean) * (x - summary.mean);
+            });
+            summary.stddev = std::sqrt(squares / (count - 1));
+        }
+
+        return summary;
+    }
+
+    RankTest mann_whitney(const std::vector<double>& x, const std::vector<double>& y) {
+        RankTest test;
+        if (x.empty() || y.empty()) {
+            return test;
+        }
+
+        // pool both sets, remembering which one every sample came from
+        std::vector<std::pair<double, bool>> pooled;
+        pooled.reserve(x.size() + y.size());
+        for (const auto value : x) {
+            pooled.emplace_back(value, true);
+        }
+        for (const auto value : y) {
+            pooled.emplace_back(value, false);
+        }
+        std::sort(pooled.begin(), pooled.end());
+
+        // tied samples share the mean of their ranks
+        double x_ranks = 0;
+        double ties = 0;  // sum of t^3 - t over the groups of t tied samples
+        for (std::size_t begin = 0; begin != pooled.size();) {
+            auto end = begin + 1;
+            while (end != pooled.size() && pooled[end].first == pooled[begin].first) {
+                end++;
+            }
+
+            const auto rank = static_cast<double>(begin + end + 1) / 2;
+            for (auto i = begin; i != end; i++) {
+                x_ranks += pooled[i].second ? rank : 0;
+            }
+            const auto group = static_cast<double>(end - begin);
+            ties += group * group * group - group;
+            begin = end;
+        }
+
+        const auto n = static_cast<double>(x.size());
+        const auto m = static_cast<double>(y.size());
+        const auto total = n + m;
+        test.u = x_ranks - n * (n + 1) / 2;
+
+        const auto mean = n * m / 2;
+        const auto variance = n * m / 12 * ((total + 1) - ties / (total * (total - 1)));
+        if (variance <= 0) {
+            return test;
+        }
+
+        const auto sigma = std::sqrt(variance);
+        // P(Z >= z) of the standard normal distribution
+        const auto upper_tail = [](double z) { return std::erfc(z / std::sqrt(2.0)) / 2; };
+        test.p_greater = upper_tail((test.u - mean - 0.5) / sigma);
+        test.p_less = upper_tail((mean - test.u - 0.5) / sigma);
+        return test;
+    }
+}  // namespace core
@@ -0,0 +1,141 @@
+#include <common/thread_pool.hpp>
+
+#include <algorithm>
+#include <utility>
+
+
+namespace core {
+    namespace {
+        thread_local const ThreadPool* current_pool = nullptr;
+        thread_local std::size_t current_index = 0;
+    }  // namespace
+
+
+    ThreadPool::ThreadPool(std::size_t threads) {
+        threads = std::max<std::size_t>(threads, 1);
+
+        queues_.reserve(threads);
+        for (std::size_t i = 0; i != threads; i++) {
+            queues_.emplace_back(std::make_unique<Queue>());
+        }
+
+        threads_.reserve(threads);
+        for (std::size_t i = 0; i != threads; i++) {
+            threads_.emplace_back([this, i]() { run(i); });
+        }
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            const std::lock_guard lock(mutex_);
+            stopping_ = true;
+        }
+        wake_.notify_all();
+
+        for (auto& thread : threads_) {
+            thread.join();
+        }
+    }
+
+    void ThreadPool::submit(Task task) {
+        {
+            // the counters go up together with the push: a worker that pops the task right away must find them
+            // already raised, or finishing it would drop `pending_` below the tasks that are still running
+            const std::lock_guard lock(mutex_);
+            std::size_t index = current_index;
+            if (current_pool != this) {
+                index = next_queue_;
+                next_queue_ = (next_queue_ + 1) % queues_.size();
+            }
+
+            auto& queue = *queues_[index];
+            const std::lock_guard queue_lock(queue.mutex);
+            queue.tasks.push_back(std::move(task));
+            queued_++;
+            pending_++;
+        }
+        wake_.notify_one();
+    }
+
+    bool ThreadPool::in_worker() noexcept {
+        return current_pool != nullptr;
+    }
+
+    void ThreadPool::wait() {
+        std::unique_lock lock(mutex_);
+        idle_.wait(lock, [this]() { return pending_ == 0; });
+
+        if (error_) {
+            std::rethrow_exception(std::exchange(error_, nullptr));
+        }
+    }
+
+    void ThreadPool::run(std::size_t index) {
+        current_pool = this;
+        current_index = index;
+
+        while (true) {
+            Task task;
+            if (try_pop(index, task)) {
+                std::exception_ptr error;
+                try {
+                    task();
+                } catch (...) {
+                    error = std::current_exception();
+                }
+                finish_task(error);
+                continue;
+            }
+
+            std::unique_lock lock(mutex_);
+            wake_.wait(lock, [this]() { return stopping_ || queued_ != 0; });
+            if (stopping_ && queued_ == 0) {
+                return;
+            }
+        }
+    }
+
+    bool ThreadPool::try_pop(std::size_t index, Task& task) {
+        const auto take = [&task](Queue& queue, bool own) {
+            const std::lock_guard lock(queue.mutex);
+            if (queue.tasks.empty()) {
+                return false;
+            }
+
+            if (own) {
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+            } else {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+            }
+            return true;
+        };
+
+        bool found = take(*queues_[index], true);
+        for (std::size_t offset = 1; !found && offset != queues_.size(); offset++) {
+            found = take(*queues_[(index + offset) % queues_.size()], false);
+        }
+
+        if (found) {
+            const std::lock_guard lock(mutex_);
+            queued_--;
+        }
+        return found;
+    }
+
+    void ThreadPool::finish_task(std::exception_ptr error) {
+        bool idle = false;
+        {
+            const std::lock_guard lock(mutex_);
+            if (error && !error_) {
+                error_ = std::move(error);
+            }
+            idle = --pending_ == 0;
+        }
+
+        if (idle) {
+            idle_.notify_all();
+        }
+    }
+}  // namespace core
@@ -0,0 +1,60 @@
+#include <common/timing.hpp>
+
+#include <cstdint>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+
+namespace core {
+    namespace {
+#ifdef _WIN32
+        std::chrono::nanoseconds to_duration(const FILETIME& kernel, const FILETIME& user) noexcept {
+            const auto ticks = [](const FILETIME& time) {
+                return (static_cast<std::uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime;
+            };
+            // FILETIME counts 100ns ticks
+            return std::chrono::nanoseconds((ticks(kernel) + ticks(user)) * 100);
+        }
+#else
+        std::chrono::nanoseconds read_clock(clockid_t clock) noexcept {
+            timespec spec{};
+            ::clock_gettime(clock, &spec);
+            return std::chrono::seconds(spec.tv_sec) + std::chrono::nanoseconds(spec.tv_nsec);
+        }
+#endif
+    }  // namespace
+
+
+    std::chrono::nanoseconds thread_cpu_time() noexcept {
+#ifdef _WIN32
+        FILETIME creation{};
+        FILETIME exit{};
+        FILETIME kernel{};
+        FILETIME user{};
+        ::GetThreadTimes(::GetCurrentThread(), &creation, &exit, &kernel, &user);
+        return to_duration(kernel, user);
+#else
+        return read_clock(CLOCK_THREAD_CPUTIME_ID);
+#endif
+    }
+
+    std::chrono::nanoseconds process_cpu_time() noexcept {
+#ifdef _WIN32
+        FILETIME creation{};
+        FILETIME exit{};
+        FILETIME kernel{};
+        FILETIME user{};
+        ::GetProcessTimes(::GetCurrentProcess(), &creation, &exit, &kernel, &user);
+        return to_duration(kernel, user);
+#else
+        return read_clock(CLOCK_PROCESS_CPUTIME_ID);
+#endif
+    }
+}  // namespace core
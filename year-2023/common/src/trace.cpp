@@ -0,0 +1,57 @@
+#include <common/trace.hpp>
+
+#include <cstdlib>
+#include <memory>
+#include <stdexcept>
+
+
+namespace io {
+    TraceSink::TraceSink(std::FILE* out)
+        : out_(out) {
+        buffer_.reserve(BlockSize + BlockSize / 4);
+    }
+
+    TraceSink::~TraceSink() {
+        flush();
+    }
+
+    void TraceSink::flush() {
+        const std::lock_guard lock(mutex_);
+        write_out();
+        std::fflush(out_);
+    }
+
+    void TraceSink::write_out() {
+        std::fwrite(buffer_.data(), 1, buffer_.size(), out_);
+        buffer_.clear();
+    }
+
+
+    TraceSink* trace() {
+        // the file has to outlive the sink, which flushes into it when it is destroyed
+        struct Trace {
+            std::unique_ptr<std::FILE, int (*)(std::FILE*)> file{nullptr, std::fclose};
+            std::unique_ptr<TraceSink> sink;
+        };
+
+        static const auto instance = [] {
+            Trace trace;
+            const char* value = std::getenv("AOC_TRACE");
+            if (value == nullptr || *value == '\0' || std::string_view(value) == "0") {
+                return trace;
+            }
+
+            std::FILE* out = stderr;
+            if (std::string_view(value) != "1") {
+                trace.file.reset(std::fopen(value, "w"));
+                if (!trace.file) {
+                    throw std::runtime_error("unable to open the trace file '" + std::string(value) + "'");
+                }
+                out = trace.file.get();
+            }
+            trace.sink = std::make_unique<TraceSink>(out);
+            return trace;
+        }();
+        return instance.sink.get();
+    }
+}  // namespace io
@@ -0,0 +1,132 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <common/io.hpp>
+#include <common/puzzle.hpp>
+
+#include "protocol.hpp"
+
+
+namespace {
+    struct Options {
+        std::filesystem::path socket = protocol::default_socket();
+        std::optional<aoc::Part> part;
+        std::size_t repeat = 1;
+        unsigned day = 0;
+        std::filesystem::path input = "input.txt";  // "-" reads stdin
+    };
+
+    void print_usage(std::string_view program) {
+        std::cerr << "usage: " << program << " [--socket <path>] [--part 1|2] [--repeat <runs>] <day> [<input>|-]\n"
+                  << "  --socket  where aoc-daemon listens (default: " << protocol::default_socket().string() << ")\n"
+                  << "  --part    part to solve (default: the part the day answers)\n"
+                  << "  --repeat  requests sent one after the other on the same connection (default: 1)\n"
+                  << "  day       day number to solve\n"
+                  << "  input     puzzle input, '-' for stdin (default: input.txt)" << std::endl;
+    }
+
+    Options parse_options(int argc, char** argv) {
+        Options options;
+
+        const std::vector<std::string_view> args(argv + 1, argv + argc);
+        std::vector<std::string_view> positional;
+        for (std::size_t i = 0; i != args.size(); i++) {
+            const auto arg = args[i];
+            if (arg == "--socket" && i + 1 != args.size()) {
+                options.socket = args[++i];
+            } else if (arg == "--part" && i + 1 != args.size()) {
+                auto value = args[++i];
+                const auto part = io::read<int>(value);
+                if (part != 1 && part != 2) {
+                    throw std::invalid_argument("part must be 1 or 2");
+                }
+                options.part = static_cast<aoc::Part>(part);
+            } else if (arg == "--repeat" && i + 1 != args.size()) {
+                auto value = args[++i];
+                options.repeat = std::max<std::size_t>(io::read<std::size_t>(value), 1);
+            } else if (arg.starts_with("--")) {
+                throw std::invalid_argument("unexpected argument '" + std::string(arg) + "'");
+            } else {
+                positional.push_back(arg);
+            }
+        }
+
+        if (positional.empty() || positional.size() > 2) {
+            throw std::invalid_argument("expected a day and at most one input");
+        }
+        auto day = positional[0];
+        options.day = io::read<unsigned>(day);
+        if (positional.size() == 2) {
+            options.input = positional[1];
+        }
+
+        return options;
+    }
+
+    double to_ms(std::uint64_t ns) {
+        return static_cast<double>(ns) / 1e6;
+    }
+}  // namespace
+
+
+int main(int argc, char** argv) {
+    std::optional<Options> options;
+    try {
+        options = parse_options(argc, argv);
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << std::endl;
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    try {
+        std::string input;
+        if (options->input == "-") {
+            input = io::read_stream(stdin);
+        } else {
+            const io::MappedFile file(options->input);
+            input = file.view();
+        }
+
+        const auto socket = protocol::connect_to(options->socket);
+        std::cerr << std::fixed << std::setprecision(3);
+        for (std::size_t run = 0; run != options->repeat; run++) {
+            const auto start = std::chrono::steady_clock::now();
+            protocol::write_request(socket.get(), options->day, options->part, input);
+            const auto response = protocol::read_response(socket.get());
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+
+            if (!response) {
+                throw std::runtime_error("the server closed the connection");
+            }
+            if (!response->answer) {
+                throw std::runtime_error(response->error);
+            }
+
+            if (run == 0) {
+                std::cout << "The result value is " << *response->answer << std::endl;
+            }
+            std::cerr << "parse " << to_ms(response->parse_ns) << " ms, solve " << to_ms(response->solve_ns)
+                      << " ms, round trip " << std::chrono::duration<double, std::milli>(elapsed).count() << " ms"
+                      << std::endl;
+        }
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,233 @@
+#include "protocol.hpp"
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+#include <tuple>
+#include <utility>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+
+namespace protocol {
+    namespace {
+        struct RequestHeader {
+            std::uint32_t magic = Magic;
+            std::uint32_t day = 0;
+            std::uint32_t part = 0;  // 0 for the day's own part
+            std::uint32_t reserved = 0;
+            std::uint64_t input_size = 0;
+        };
+
+        struct ResponseHeader {
+            std::uint32_t magic = Magic;
+            std::uint32_t solved = 0;
+            std::uint64_t answer = 0;
+            std::uint64_t parse_ns = 0;
+            std::uint64_t solve_ns = 0;
+            std::uint64_t error_size = 0;
+        };
+
+        [[noreturn]] void throw_errno(const char* what) {
+            throw std::system_error(errno, std::system_category(), what);
+        }
+
+        void write_all(int socket, const void* data, std::size_t size) {
+            const auto* bytes = static_cast<const char*>(data);
+            while (size != 0) {
+                // MSG_NOSIGNAL: a client that went away is an error here, not a process-wide SIGPIPE
+                const auto written = ::send(socket, bytes, size, MSG_NOSIGNAL);
+                if (written < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    throw_errno("unable to write to the socket");
+                }
+                bytes += written;
+                size -= static_cast<std::size_t>(written);
+            }
+        }
+
+        // False when the peer closed the connection before the first byte.
+        bool read_all(int socket, void* data, std::size_t size) {
+            auto* bytes = static_cast<char*>(data);
+            const auto total = size;
+            while (size != 0) {
+                const auto received = ::recv(socket, bytes, size, 0);
+                if (received < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    throw_errno("unable to read from the socket");
+                }
+                if (received == 0) {
+                    if (size == total) {
+                        return false;
+                    }
+                    throw std::runtime_error("the connection closed in the middle of a message");
+                }
+                bytes += received;
+                size -= static_cast<std::size_t>(received);
+            }
+            return true;
+        }
+
+        void read_payload(int socket, std::string& payload, std::uint64_t size) {
+            if (size > MaxInputSize) {
+                throw std::invalid_argument("the message is too large");
+            }
+            payload.resize(static_cast<std::size_t>(size));
+            if (size != 0 && !read_all(socket, payload.data(), payload.size())) {
+                throw std::runtime_error("the connection closed in the middle of a message");
+            }
+        }
+
+        sockaddr_un make_address(const std::filesystem::path& path) {
+            sockaddr_un address{};
+            address.sun_family = AF_UNIX;
+
+            const auto& name = path.native();
+            if (name.size() >= sizeof(address.sun_path)) {
+                throw std::invalid_argument("socket path is too long: " + name);
+            }
+            std::memcpy(address.sun_path, name.c_str(), name.size() + 1);
+            return address;
+        }
+
+        Socket make_socket() {
+            Socket socket(::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0));
+            if (socket.get() == -1) {
+                throw_errno("unable to create a socket");
+            }
+            return socket;
+        }
+    }  // namespace
+
+
+    std::filesystem::path default_socket() {
+        if (const char* path = std::getenv("AOC_SOCKET"); path != nullptr && *path != '\0') {
+            return path;
+        }
+        if (const char* directory = std::getenv("XDG_RUNTIME_DIR"); directory != nullptr && *directory != '\0') {
+            return std::filesystem::path(directory) / "aoc.sock";
+        }
+        return "/tmp/aoc-" + std::to_string(::getuid()) + ".sock";
+    }
+
+
+    Socket::~Socket() {
+        if (descriptor_ != -1) {
+            ::close(descriptor_);
+        }
+    }
+
+    Socket::Socket(Socket&& other) noexcept
+        : descriptor_(std::exchange(other.descriptor_, -1)) {}
+
+    Socket& Socket::operator=(Socket&& other) noexcept {
+        if (this != &other) {
+            if (descriptor_ != -1) {
+                ::close(descriptor_);
+            }
+            descriptor_ = std::exchange(other.descriptor_, -1);
+        }
+        return *this;
+    }
+
+
+    Socket connect_to(const std::filesystem::path& path) {
+        auto socket = make_socket();
+        const auto address = make_address(path);
+        if (::connect(socket.get(), reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+            throw std::system_error(errno, std::system_category(), "unable to connect to '" + path.string() + "'");
+        }
+        return socket;
+    }
+
+    Socket listen_on(const std::filesystem::path& path) {
+        std::error_code error;
+        if (std::filesystem::exists(path, error)) {
+            try {
+                std::ignore = connect_to(path);
+                throw std::runtime_error("a server is already listening on '" + path.string() + "'");
+            } catch (const std::system_error&) {
+                // nobody answers: a leftover of a server that did not shut down cleanly
+                std::filesystem::remove(path, error);
+            }
+        }
+
+        auto socket = make_socket();
+        const auto address = make_address(path);
+        if (::bind(socket.get(), reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+            throw std::system_error(errno, std::system_category(), "unable to bind '" + path.string() + "'");
+        }
+        if (::listen(socket.get(), SOMAXCONN) != 0) {
+            throw_errno("unable to listen");
+        }
+        return socket;
+    }
+
+
+    void write_request(int socket, unsigned day, std::optional<aoc::Part> part, std::string_view input) {
+        const RequestHeader header{
+            .day = day,
+            .part = part ? static_cast<std::uint32_t>(*part) : 0,
+            .input_size = input.size(),
+        };
+        write_all(socket, &header, sizeof(header));
+        write_all(socket, input.data(), input.size());
+    }
+
+    std::optional<Request> read_request(int socket) {
+        RequestHeader header;
+        if (!read_all(socket, &header, sizeof(header))) {
+            return std::nullopt;
+        }
+        if (header.magic != Magic || header.part > 2) {
+            throw std::invalid_argument("malformed request");
+        }
+
+        Request request{
+            .day = header.day,
+            .part = header.part != 0 ? std::optional(static_cast<aoc::Part>(header.part)) : std::nullopt,
+            .input = {},
+        };
+        read_payload(socket, request.input, header.input_size);
+        return request;
+    }
+
+    void write_response(int socket, const Response& response) {
+        const ResponseHeader header{
+            .solved = response.answer ? 1u : 0u,
+            .answer = response.answer.value_or(0),
+            .parse_ns = response.parse_ns,
+            .solve_ns = response.solve_ns,
+            .error_size = response.error.size(),
+        };
+        write_all(socket, &header, sizeof(header));
+        write_all(socket, response.error.data(), response.error.size());
+    }
+
+    std::optional<Response> read_response(int socket) {
+        ResponseHeader header;
+        if (!read_all(socket, &header, sizeof(header))) {
+            return std::nullopt;
+        }
+        if (header.magic != Magic) {
+            throw std::invalid_argument("malformed response");
+        }
+
+        Response response{
+            .answer = header.solved != 0 ? std::optional<aoc::Answer>(header.answer) : std::nullopt,
+            .error = {},
+            .parse_ns = header.parse_ns,
+            .solve_ns = header.solve_ns,
+        };
+        read_payload(socket, response.error, header.error_size);
+        return response;
+    }
+}  // namespace protocol
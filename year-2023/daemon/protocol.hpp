@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <common/puzzle.hpp>
+
+
+// Wire format between aoc-daemon and its clients on a local Unix socket. Both ends run on the same host, so the
+// fixed-size headers travel in native byte order; every header is followed by the bytes it announces. A connection
+// carries any number of request/response pairs, one at a time.
+namespace protocol {
+    inline constexpr std::uint32_t Magic = 0x41'4F'43'31;  // "AOC1"
+
+    // Inputs above this size are refused before anything is allocated for them.
+    inline constexpr std::uint64_t MaxInputSize = std::uint64_t{1} << 30;
+
+    struct Request {
+        unsigned day = 0;
+        std::optional<aoc::Part> part;  // the day's own part when empty
+        std::string input;
+    };
+
+    struct Response {
+        std::optional<aoc::Answer> answer;
+        std::string error;  // why there is no answer
+        std::uint64_t parse_ns = 0;
+        std::uint64_t solve_ns = 0;
+    };
+
+    // $AOC_SOCKET, or aoc.sock in $XDG_RUNTIME_DIR, or a per-user name in /tmp.
+    [[nodiscard]] std::filesystem::path default_socket();
+
+    // Owning socket descriptor.
+    class Socket {
+    public:
+        Socket() = default;
+        explicit Socket(int descriptor) noexcept
+            : descriptor_(descriptor) {}
+        ~Socket();
+
+        Socket(const Socket&) = delete;
+        Socket& operator=(const Socket&) = delete;
+        Socket(Socket&& other) noexcept;
+        Socket& operator=(Socket&& other) noexcept;
+
+        [[nodiscard]] int get() const noexcept {
+            return descriptor_;
+        }
+
+    private:
+        int descriptor_ = -1;
+    };
+
+    // Both throw std::system_error. `listen_on` replaces a stale socket file but refuses to take over the path of
+    // a server that still answers.
+    [[nodiscard]] Socket connect_to(const std::filesystem::path& path);
+    [[nodiscard]] Socket listen_on(const std::filesystem::path& path);
+
+    // Reading returns nothing when the peer closed the connection between two messages; every other failure,
+    // including a malformed message, throws.
+    void write_request(int socket, unsigned day, std::optional<aoc::Part> part, std::string_view input);
+    [[nodiscard]] std::optional<Request> read_request(int socket);
+
+    void write_response(int socket, const Response& response);
+    [[nodiscard]] std::optional<Response> read_response(int socket);
+}  // namespace protocol
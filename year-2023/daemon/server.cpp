@@ -0,0 +1,240 @@
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <tuple>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <common/io.hpp>
+#include <common/puzzle.hpp>
+#include <common/thread_pool.hpp>
+#include <puzzles/puzzles.hpp>
+
+#include <signal.h>
+#include <sys/socket.h>
+
+#include "protocol.hpp"
+
+
+namespace {
+    struct Options {
+        std::filesystem::path socket = protocol::default_socket();
+        std::filesystem::path inputs = AOC_INPUTS_DIR;
+        std::size_t threads = std::thread::hardware_concurrency();
+        bool warmup = true;
+    };
+
+    void print_usage(std::string_view program) {
+        std::cerr << "usage: " << program << " [--socket <path>] [--threads <count>] [--inputs <dir>] [--no-warmup]\n"
+                  << "  --socket     where to listen (default: " << protocol::default_socket().string() << ")\n"
+                  << "  --threads    connections served at the same time (default: hardware concurrency)\n"
+                  << "  --inputs     directory holding the day-N/test-data.txt files solved once at start-up"
+                  << " (default: " << AOC_INPUTS_DIR << ")\n"
+                  << "  --no-warmup  accept requests right away, without solving the test data first" << std::endl;
+    }
+
+    Options parse_options(int argc, char** argv) {
+        Options options;
+
+        const std::vector<std::string_view> args(argv + 1, argv + argc);
+        for (std::size_t i = 0; i != args.size(); i++) {
+            const auto arg = args[i];
+            if (arg == "--socket" && i + 1 != args.size()) {
+                options.socket = args[++i];
+            } else if (arg == "--threads" && i + 1 != args.size()) {
+                auto value = args[++i];
+                options.threads = io::read<std::size_t>(value);
+            } else if (arg == "--inputs" && i + 1 != args.size()) {
+                options.inputs = args[++i];
+            } else if (arg == "--no-warmup") {
+                options.warmup = false;
+            } else {
+                throw std::invalid_argument("unexpected argument '" + std::string(arg) + "'");
+            }
+        }
+
+        options.threads = std::max<std::size_t>(options.threads, 1);
+        return options;
+    }
+
+    // Solves every day once on its test data, so the code, the allocator and any static tables are hot before the
+    // first real request. A day that fails here fails again for its requests, where the error is reported.
+    void warm_up(const std::filesystem::path& inputs) {
+        for (const auto& puzzle : year2023::puzzles()) {
+            const auto path = inputs / ("day-" + std::to_string(puzzle.day)) / "test-data.txt";
+            std::error_code error;
+            if (!std::filesystem::exists(path, error)) {
+                continue;
+            }
+
+            try {
+                const io::MappedFile document(path);
+                const auto solution = puzzle.create();
+                solution->parse(document.view());
+                std::ignore = solution->solve(puzzle.part);
+            } catch (const std::exception&) {
+            }
+        }
+    }
+
+    protocol::Response answer(const protocol::Request& request) {
+        protocol::Response response;
+
+        const auto* puzzle = year2023::find_puzzle(request.day);
+        if (puzzle == nullptr) {
+            response.error = "unknown day " + std::to_string(request.day);
+            return response;
+        }
+
+        const auto elapsed_ns = [](auto from, auto to) {
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(to - from).count());
+        };
+
+        // a fresh solution per request: solvers keep state between parse and solve and are not thread-safe
+        try {
+            const auto start = std::chrono::steady_clock::now();
+            const auto solution = puzzle->create();
+            solution->parse(request.input);
+            const auto parsed = std::chrono::steady_clock::now();
+            response.answer = solution->solve(request.part.value_or(puzzle->part));
+            const auto solved = std::chrono::steady_clock::now();
+
+            response.parse_ns = elapsed_ns(start, parsed);
+            response.solve_ns = elapsed_ns(parsed, solved);
+        } catch (const std::exception& error) {
+            response.error = error.what();
+        }
+        return response;
+    }
+
+    // Descriptors of the connections being served, so shutting down can wake the workers blocked reading them.
+    class Connections {
+    public:
+        void add(int socket) {
+            const std::lock_guard lock(mutex_);
+            sockets_.insert(socket);
+        }
+
+        void remove(int socket) {
+            const std::lock_guard lock(mutex_);
+            sockets_.erase(socket);
+        }
+
+        void shutdown_all() {
+            const std::lock_guard lock(mutex_);
+            for (const auto socket : sockets_) {
+                ::shutdown(socket, SHUT_RDWR);
+            }
+        }
+
+    private:
+        std::mutex mutex_;
+        std::unordered_set<int> sockets_;
+    };
+
+    // `socket` must already be in `connections`, so a connection still waiting for a worker is shut down as well.
+    void serve(protocol::Socket socket, Connections& connections) {
+        try {
+            while (const auto request = protocol::read_request(socket.get())) {
+                protocol::write_response(socket.get(), answer(*request));
+            }
+        } catch (const std::exception& error) {
+            std::cerr << "connection dropped: " << error.what() << std::endl;
+        }
+        connections.remove(socket.get());
+    }
+
+
+    std::atomic<int> listening{-1};
+    std::atomic<bool> stopping{false};
+
+    void handle_stop(int) {
+        stopping = true;
+        // async-signal-safe, and makes the blocked accept() return whichever thread took the signal
+        ::shutdown(listening.load(), SHUT_RDWR);
+    }
+
+    void install_signal_handlers() {
+        std::signal(SIGPIPE, SIG_IGN);
+
+        struct sigaction action{};
+        action.sa_handler = handle_stop;
+        sigemptyset(&action.sa_mask);
+        action.sa_flags = 0;  // no SA_RESTART: accept() has to come back to look at `stopping`
+        sigaction(SIGINT, &action, nullptr);
+        sigaction(SIGTERM, &action, nullptr);
+    }
+}  // namespace
+
+
+int main(int argc, char** argv) {
+    std::optional<Options> options;
+    try {
+        options = parse_options(argc, argv);
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << std::endl;
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (options->warmup) {
+        warm_up(options->inputs);
+    }
+
+    protocol::Socket server;
+    try {
+        server = protocol::listen_on(options->socket);
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    listening = server.get();
+    install_signal_handlers();
+    std::cerr << "listening on " << options->socket.string() << " with " << options->threads << " threads"
+              << std::endl;
+
+    Connections connections;
+    {
+        core::ThreadPool pool(options->threads);
+        while (!stopping) {
+            protocol::Socket client(::accept4(server.get(), nullptr, nullptr, SOCK_CLOEXEC));
+            if (client.get() == -1) {
+                if (errno == EINTR || errno == ECONNABORTED) {
+                    continue;
+                }
+                if (!stopping) {
+                    std::cerr << std::system_error(errno, std::system_category(), "accept failed").what() << std::endl;
+                }
+                break;
+            }
+            connections.add(client.get());
+            pool.submit([&connections, socket = std::make_shared<protocol::Socket>(std::move(client))]() {
+                serve(std::move(*socket), connections);
+            });
+        }
+
+        connections.shutdown_all();
+        pool.wait();
+    }
+
+    std::error_code error;
+    std::filesystem::remove(options->socket, error);
+    return EXIT_SUCCESS;
+}
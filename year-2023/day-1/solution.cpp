@@ -0,0 +1,236 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#include <common/io.hpp>
+#include <common/numbers.hpp>
+#include <common/parallel.hpp>
+#include <common/puzzle.hpp>
+#include <common/trace.hpp>
+
+#include "embedded_data.hpp"
+
+
+namespace {
+    namespace parsing {
+        constexpr std::array<std::pair<std::string_view, std::uint16_t>, 20> DIGITS_MAP{{
+            {"0", 0},    {"1", 1},   {"2", 2},     {"3", 3},     {"4", 4},
+            {"5", 5},    {"6", 6},   {"7", 7},     {"8", 8},     {"9", 9},
+
+            {"zero", 0}, {"one", 1}, {"two", 2},   {"three", 3}, {"four", 4},
+            {"five", 5}, {"six", 6}, {"seven", 7}, {"eight", 8}, {"nine", 9},
+        }};
+
+        // Aho-Corasick automaton over the spellings of DIGITS_MAP, built at compile time into a dense transition table
+        // over the few byte classes the spellings use; every other byte is class 0 and leads back to the root. No
+        // spelling occurs inside another one, so the first match to complete is also the one that starts first.
+        // The reversed automaton matches the mirrored spellings, for reading a line from its end.
+        template<bool Reversed>
+        class DigitAutomaton {
+        public:
+            struct Match {
+                std::size_t begin = 0;
+                std::uint16_t digit = 0;
+            };
+
+            consteval DigitAutomaton() {
+                std::uint8_t classes = 1;
+                for (const auto& [word, _] : DIGITS_MAP) {
+                    for (const auto symbol : word) {
+                        auto& symbol_class = classes_[static_cast<unsigned char>(symbol)];
+                        if (symbol_class == 0) {
+                            symbol_class = classes++;
+                        }
+                    }
+                }
+
+                // the trie, where 0 marks a missing child: the root is nobody's child
+                std::uint8_t states = 1;
+                for (const auto& [word, digit] : DIGITS_MAP) {
+                    std::uint8_t state = 0;
+                    for (std::size_t i = 0; i != word.size(); i++) {
+                        const auto symbol = word[Reversed ? word.size() - 1 - i : i];
+                        auto& child = next_[state][classes_[static_cast<unsigned char>(symbol)]];
+                        if (child == 0) {
+                            child = states++;
+                        }
+                        state = child;
+                    }
+                    digits_[state] = digit;
+                    lengths_[state] = static_cast<std::uint8_t>(word.size());
+                }
+
+                // breadth first, so the failure state of every node is complete before the node is
+                std::array<std::uint8_t, MaxStates> fail{};
+                std::array<std::uint8_t, MaxStates> queue{};
+                std::size_t head = 0;
+                std::size_t tail = 0;
+                for (std::size_t k = 0; k != classes; k++) {
+                    if (const auto child = next_[0][k]; child != 0) {
+                        queue[tail++] = child;
+                    }
+                }
+                while (head != tail) {
+                    const auto state = queue[head++];
+                    for (std::size_t k = 0; k != classes; k++) {
+                        const auto child = next_[state][k];
+                        const auto fallback = next_[fail[state]][k];
+                        if (child == 0) {
+                            next_[state][k] = fallback;
+                            continue;
+                        }
+
+                        fail[child] = fallback;
+                        if (digits_[child] == NoDigit) {
+                            digits_[child] = digits_[fallback];
+                            lengths_[child] = lengths_[fallback];
+                        }
+                        queue[tail++] = child;
+                    }
+                }
+            }
+
+            // The match that starts first in `text`, or for the reversed automaton the one that ends last.
+            [[nodiscard]] constexpr std::optional<Match> find(std::string_view text) const noexcept {
+                std::uint8_t state = 0;
+                for (std::size_t i = 0; i != text.size(); i++) {
+                    const auto at = Reversed ? text.size() - 1 - i : i;
+                    state = next_[state][classes_[static_cast<unsigned char>(text[at])]];
+                    if (digits_[state] != NoDigit) {
+                        return Match{.begin = Reversed ? at : at + 1 - lengths_[state], .digit = digits_[state]};
+                    }
+                }
+                return std::nullopt;
+            }
+
+        private:
+            static constexpr std::size_t MaxStates = 64;
+            static constexpr std::size_t MaxClasses = 32;
+            static constexpr std::uint16_t NoDigit = 0xffff;
+
+            static constexpr std::array<std::uint16_t, MaxStates> no_digits() {
+                std::array<std::uint16_t, MaxStates> digits{};
+                digits.fill(NoDigit);
+                return digits;
+            }
+
+            std::array<std::uint8_t, 256> classes_{};
+            std::array<std::array<std::uint8_t, MaxClasses>, MaxStates> next_{};
+            std::array<std::uint16_t, MaxStates> digits_ = no_digits();  // the digit a match ending here spells
+            std::array<std::uint8_t, MaxStates> lengths_{};              // and the length of its spelling
+        };
+
+        constexpr DigitAutomaton<false> FORWARD;
+        constexpr DigitAutomaton<true> BACKWARD;
+
+        constexpr std::uint16_t get_first_digit(std::string_view line) {
+            const auto match = FORWARD.find(line);
+            return match ? match->digit : 0;
+        }
+
+        constexpr std::uint16_t get_last_digit(std::string_view line) {
+            const auto match = BACKWARD.find(line);
+            return match ? match->digit : 0;
+        }
+
+        // Reads the line forwards up to its first match and backwards down to its last one, which cannot start
+        // before the first: each byte is looked at about once, without allocating.
+        constexpr std::uint16_t get_calibration(std::string_view line) {
+            const auto first = FORWARD.find(line);
+            if (!first) {
+                return 0;
+            }
+            const auto last = BACKWARD.find(line.substr(first->begin));
+            return first->digit * 10 + last->digit;  // NOLINT: concatenate two single digits
+        }
+
+        // Part one counts digits only, which the vectorised scans of io find a register of bytes at a time.
+        inline std::uint16_t get_digit_calibration(std::string_view line) {
+            const auto first = io::find_first_digit(line);
+            if (first == std::string_view::npos) {
+                return 0;
+            }
+            const auto last = first + io::find_last_digit(line.substr(first));
+            return static_cast<std::uint16_t>((line[first] - '0') * 10 + (line[last] - '0'));
+        }
+    }  // namespace parsing
+
+    constexpr std::uint32_t sum_calibrations(std::string_view document) {
+        std::uint32_t sum = 0;
+        for (const auto line : io::lines(document)) {
+            sum += parsing::get_calibration(line);
+        }
+        return sum;
+    }
+
+    static_assert(parsing::get_first_digit("xtwone3four") == 2);
+    static_assert(parsing::get_last_digit("zoneight234") == 4);
+    static_assert(sum_calibrations(embedded::test_data) == 281);
+
+
+    // Hands `use` the calibration function of `part`: `calibrate` itself, or with AOC_TRACE set a wrapper that also
+    // records "part N: line -> calibration" in the trace, so the quiet path does not even test for tracing per line.
+    template<typename Calibrate, typename Use>
+    decltype(auto) with_trace(aoc::Part part, Calibrate calibrate, Use use) {
+        if (auto* const sink = io::trace()) {
+            return use([sink, part, calibrate](std::string_view line) {
+                const auto calibration = calibrate(line);
+                sink->record("part ", static_cast<int>(part), ": ", line, " -> ", calibration);
+                return calibration;
+            });
+        }
+        return use(calibrate);
+    }
+
+
+    class Trebuchet final : public aoc::Solution, public aoc::StreamingSolution {
+    public:
+        // Each part reads the lines its own way, so parsing only keeps the text and the scans are all solving.
+        void parse(std::string_view input) override {
+            document_ = input;
+        }
+
+        [[nodiscard]] aoc::Answer solve(aoc::Part part) override {
+            const auto sum = [this](auto calibrate) {
+                return core::map_reduce_lines(document_, aoc::Answer{0}, calibrate, std::plus<>());
+            };
+
+            if (part == aoc::Part::ONE) {
+                return with_trace(part, parsing::get_digit_calibration, sum);
+            }
+            return with_trace(part, parsing::get_calibration, sum);
+        }
+
+        [[nodiscard]] aoc::Answer solve_stream(io::StreamReader& input, aoc::Part part) override {
+            const auto sum = [&input](auto calibrate) {
+                aoc::Answer sum = 0;
+                std::string_view line;
+                while (input.next(line)) {
+                    if (!line.empty()) {
+                        sum += calibrate(line);
+                    }
+                }
+                return sum;
+            };
+
+            if (part == aoc::Part::ONE) {
+                return with_trace(part, parsing::get_digit_calibration, sum);
+            }
+            return with_trace(part, parsing::get_calibration, sum);
+        }
+
+    private:
+        std::string_view document_;
+    };
+}  // namespace
+
+
+namespace year2023 {
+    aoc::Puzzle trebuchet() {
+        return aoc::make_puzzle<Trebuchet>(1, "trebuchet", aoc::Part::TWO);
+    }
+}  // namespace year2023
@@ -1,43 +1,10 @@
-#include <algorithm>
-#include <cstddef>
-#include <cstdint>
-#include <fstream>
-#include <iostream>
-#include <iterator>
-#include <regex>
-#include <sstream>
-#include <stdexcept>
-#include <string>
-#include <string_view>
-#include <tuple>
-#include <unordered_map>
-#include <utility>
-#include <vector>
+#include <common/puzzle.hpp>
 
-namespace io {
-    template<typename T>
-    T read(std::istream& input) {
-        T value{};
-        input >> value;
-        return value;
-    }
+namespace year2023 {
+    aoc::Puzzle pipe_maze();
+}  // namespace year2023
 
-    template<typename T>
-    std::vector<T> read(std::istream& input, std::size_t count) {
-        std::vector<T> result;
 
-        result.reserve(count);
-        while (count--) {
-            auto value = read<T>(input);
-            result.emplace_back(std::move(value));
-        }
-
-        return result;
-    }
-}  // namespace io
-
-int main() {
-    std::ifstream document(R"(test-data.txt)");
-    std::cout << "The result is " << 0 << std::endl;
-    return 0;
+int main(int argc, char** argv) {
+    return aoc::solve_puzzle(year2023::pipe_maze(), argc, argv);
 }
@@ -0,0 +1,22 @@
+#include <string_view>
+
+#include <common/puzzle.hpp>
+
+
+namespace {
+    class HotSprings final : public aoc::Solution {
+    public:
+        void parse(std::string_view) override {}
+
+        [[nodiscard]] aoc::Answer solve(aoc::Part part) override {
+            throw aoc::UnsolvedPart(part);
+        }
+    };
+}  // namespace
+
+
+namespace year2023 {
+    aoc::Puzzle hot_springs() {
+        return aoc::make_puzzle<HotSprings>(12, "hot-springs", aoc::Part::ONE);
+    }
+}  // namespace year2023
@@ -0,0 +1,22 @@
+#include <string_view>
+
+#include <common/puzzle.hpp>
+
+
+namespace {
+    class PointOfIncidence final : public aoc::Solution {
+    public:
+        void parse(std::string_view) override {}
+
+        [[nodiscard]] aoc::Answer solve(aoc::Part part) override {
+            throw aoc::UnsolvedPart(part);
+        }
+    };
+}  // namespace
+
+
+namespace year2023 {
+    aoc::Puzzle point_of_incidence() {
+        return aoc::make_puzzle<PointOfIncidence>(13, "point-of-incidence", aoc::Part::ONE);
+    }
+}  // namespace year2023
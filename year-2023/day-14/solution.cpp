@@ -0,0 +1,22 @@
+#include <string_view>
+
+#include <common/puzzle.hpp>
+
+
+namespace {
+    class ParabolicReflectorDish final : public aoc::Solution {
+    public:
+        void parse(std::string_view) override {}
+
+        [[nodiscard]] aoc::Answer solve(aoc::Part part) override {
+            throw aoc::UnsolvedPart(part);
+        }
+    };
+}  // namespace
+
+
+namespace year2023 {
+    aoc::Puzzle parabolic_reflector_dish() {
+        return aoc::make_puzzle<ParabolicReflectorDish>(14, "parabolic-reflector-dish", aoc::Part::ONE);
+    }
+}  // namespace year2023
@@ -0,0 +1,22 @@
+#include <string_view>
+
+#include <common/puzzle.hpp>
+
+
+namespace {
+    class ClumsyCrucible final : public aoc::Solution {
+    public:
+        void parse(std::string_view) override {}
+
+        [[nodiscard]] aoc::Answer solve(aoc::Part part) override {
+            throw aoc::UnsolvedPart(part);
+        }
+    };
+}  // namespace
+
+
+namespace year2023 {
+    aoc::Puzzle clumsy_crucible() {
+        return aoc::make_puzzle<ClumsyCrucible>(17, "clumsy-crucible", aoc::Part::ONE);
+    }
+}  // namespace year2023
@@ -0,0 +1,22 @@
+#include <string_view>
+
+#include <common/puzzle.hpp>
+
+
+namespace {
+    class LavaductLagoon final : public aoc::Solution {
+    public:
+        void parse(std::string_view) override {}
+
+        [[nodiscard]] aoc::Answer solve(aoc::Part part) override {
+            throw aoc::UnsolvedPart(part);
+        }
+    };
+}  // namespace
+
+
+namespace year2023 {
+    aoc::Puzzle lavaduct_lagoon() {
+        return aoc::make_puzzle<LavaductLagoon>(18, "lavaduct-lagoon", aoc::Part::ONE);
+    }
+}  // namespace year2023
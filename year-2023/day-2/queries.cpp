@@ -0,0 +1,51 @@
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <common/io.hpp>
+
+namespace year2023 {
+    std::string answer_bag_queries(std::string_view records, std::string_view bags);
+}  // namespace year2023
+
+
+namespace {
+    void print_usage(std::string_view program) {
+        std::cerr << "usage: " << program << " <games> <bags>|-\n"
+                  << "  games  game records, as in the puzzle input\n"
+                  << "  bags   one \"red green blue\" bag per line, '-' for stdin\n"
+                  << "Prints, for every bag, how many games it makes possible and the sum of their ids." << std::endl;
+    }
+}  // namespace
+
+
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    try {
+        const io::MappedFile games(argv[1]);
+
+        std::optional<io::MappedFile> file;
+        std::string piped;
+        if (std::string_view(argv[2]) == "-") {
+            piped = io::read_stream(stdin);
+        } else {
+            file.emplace(argv[2]);
+        }
+
+        const auto answers = year2023::answer_bag_queries(games.view(), file ? file->view() : std::string_view(piped));
+        std::fwrite(answers.data(), 1, answers.size(), stdout);
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
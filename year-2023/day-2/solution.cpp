@@ -0,0 +1,450 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <common/io.hpp>
+#include <common/numbers.hpp>
+#include <common/parallel.hpp>
+#include <common/puzzle.hpp>
+#include <common/snapshot.hpp>
+
+
+namespace {
+    struct Cubes {
+        std::uint32_t red = 0;
+        std::uint32_t green = 0;
+        std::uint32_t blue = 0;
+
+        bool operator<=(const Cubes& other) const {
+            return red <= other.red && green <= other.green && blue <= other.blue;
+        }
+    };
+
+    struct Bag {
+        Cubes cubes;
+    };
+
+    // Reads a record set by set and hands every set to `emit`, a colour it does not show counting as zero; returns
+    // the id of the game.
+    template<typename Emit>
+    std::uint32_t parse_game_record(std::string_view record, Emit&& emit) {
+        // Game 1: 3 blue, 4 red; 1 red, 2 green, 6 blue; 2 green
+        static constexpr std::string_view GAME_PREFIX = "Game ";
+        static constexpr std::string_view RED_COLOR = "red";
+        static constexpr std::string_view GREEN_COLOR = "green";
+        static constexpr std::string_view BLUE_COLOR = "blue";
+
+        const auto id_end = record.find(':');
+        if (!record.starts_with(GAME_PREFIX) || id_end == std::string_view::npos) {
+            throw std::invalid_argument("Invalid game record");
+        }
+        const auto id =
+            io::parse_integer<std::uint32_t>(record.substr(GAME_PREFIX.size(), id_end - GAME_PREFIX.size()));
+        record.remove_prefix(std::min(id_end + 2, record.size())); // eat ": "
+
+        while (!record.empty()) {
+            const auto set_delimiter = record.find(';');
+            auto sets_info = record.substr(0, set_delimiter);
+            Cubes set;
+            while (!sets_info.empty()) {
+                const auto delimiter = sets_info.find(',');
+                const auto cubes_info = sets_info.substr(0, delimiter);
+
+                const auto whitespace_pos = cubes_info.find(' ');
+                const auto count = io::parse_integer<std::uint32_t>(cubes_info.substr(0, whitespace_pos));
+                const auto color = cubes_info.substr(whitespace_pos + 1);
+                if (color == RED_COLOR) {
+                    set.red = count;
+                } else if (color == GREEN_COLOR) {
+                    set.green = count;
+                } else if (color == BLUE_COLOR) {
+                    set.blue = count;
+                }
+
+                const auto need_to_consume = delimiter != std::string_view::npos ? cubes_info.size() + 2 : cubes_info.size();
+                sets_info.remove_prefix(need_to_consume);
+                record.remove_prefix(need_to_consume);
+            }
+            emit(set);
+            record.remove_prefix(set_delimiter != std::string_view::npos ? 2 : 0); // consume "; "
+        }
+
+        return id;
+    }
+
+
+    // The fewest cubes of each colour that make both `a` and `b` possible.
+    Cubes most(const Cubes& a, const Cubes& b) {
+        return Cubes{
+            .red = std::max(a.red, b.red),
+            .green = std::max(a.green, b.green),
+            .blue = std::max(a.blue, b.blue),
+        };
+    }
+
+    aoc::Answer power(const Cubes& cubes) {
+        return aoc::Answer{cubes.red} * cubes.green * cubes.blue;
+    }
+
+
+    // The games as columns, one array per field: the parser appends every set to the three set columns, 12 bytes a
+    // set, and a game is the range of sets between two offsets. The fewest cubes of each colour a game needs are
+    // reduced from the set columns once, into three more columns that the questions read without touching a set.
+    // The columns are views, into the parsed arrays or into a snapshot.
+    class GameStore {
+    public:
+        explicit GameStore(std::pmr::memory_resource* memory)
+            : ids_(memory), offsets_(memory), sets_(memory), minimal_(memory) {}
+
+        void parse(std::string_view records) {
+            // every set but the last of a record ends in ';', so this is at least the number of sets
+            const auto delimiters = std::ranges::count(records, ';') + std::ranges::count(records, '\n');
+            const auto sets = static_cast<std::size_t>(delimiters) + 1;
+            sets_.resize(3 * sets);
+            const auto set_column = [this, sets](std::size_t index) {
+                return std::span(sets_).subspan(index * sets, sets);
+            };
+            const auto set_red = set_column(0);
+            const auto set_green = set_column(1);
+            const auto set_blue = set_column(2);
+
+            ids_.clear();
+            offsets_.assign(1, 0);
+            std::uint32_t count = 0;
+            for (const auto record : io::lines(records)) {
+                if (record.empty()) {
+                    continue;
+                }
+                ids_.push_back(parse_game_record(record, [&](const Cubes& set) {
+                    set_red[count] = set.red;
+                    set_green[count] = set.green;
+                    set_blue[count] = set.blue;
+                    count++;
+                }));
+                offsets_.push_back(count);
+            }
+
+            columns_.ids = ids_;
+            columns_.offsets = offsets_;
+            columns_.set_red = set_red.first(count);
+            columns_.set_green = set_green.first(count);
+            columns_.set_blue = set_blue.first(count);
+            reduce();
+        }
+
+        void save(io::SnapshotWriter& out) const {
+            out.add(columns_.ids);
+            out.add(columns_.offsets);
+            out.add(columns_.set_red);
+            out.add(columns_.set_green);
+            out.add(columns_.set_blue);
+            out.add(columns_.red);
+            out.add(columns_.green);
+            out.add(columns_.blue);
+        }
+
+        void load(const io::Snapshot& in) {
+            Columns columns;
+            columns.ids = in.section<std::uint32_t>(0);
+            columns.offsets = in.section<std::uint32_t>(1);
+            columns.set_red = in.section<std::uint32_t>(2);
+            columns.set_green = in.section<std::uint32_t>(3);
+            columns.set_blue = in.section<std::uint32_t>(4);
+            columns.red = in.section<std::uint32_t>(5);
+            columns.green = in.section<std::uint32_t>(6);
+            columns.blue = in.section<std::uint32_t>(7);
+
+            const auto games = columns.ids.size();
+            const auto sets = columns.set_red.size();
+            if (columns.offsets.size() != games + 1 || columns.offsets.front() != 0 || columns.offsets.back() != sets ||
+                columns.set_green.size() != sets || columns.set_blue.size() != sets || columns.red.size() != games ||
+                columns.green.size() != games || columns.blue.size() != games) {
+                throw std::invalid_argument("invalid snapshot: the game columns differ in length");
+            }
+            columns_ = columns;
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept {
+            return columns_.ids.size();
+        }
+
+        [[nodiscard]] std::span<const std::uint32_t> ids() const noexcept {
+            return columns_.ids;
+        }
+
+        [[nodiscard]] std::span<const std::uint32_t> red() const noexcept {
+            return columns_.red;
+        }
+
+        [[nodiscard]] std::span<const std::uint32_t> green() const noexcept {
+            return columns_.green;
+        }
+
+        [[nodiscard]] std::span<const std::uint32_t> blue() const noexcept {
+            return columns_.blue;
+        }
+
+        // Branch-free over the columns: the comparisons become a mask that selects the id.
+        [[nodiscard]] aoc::Answer sum_possible_ids(const Cubes& bag) const noexcept {
+            const auto& [ids, offsets, set_red, set_green, set_blue, red, green, blue] = columns_;
+            aoc::Answer sum = 0;
+            for (std::size_t i = 0; i != ids.size(); i++) {
+                const bool possible = (red[i] <= bag.red) & (green[i] <= bag.green) & (blue[i] <= bag.blue);
+                sum += ids[i] & (std::uint32_t{0} - static_cast<std::uint32_t>(possible));
+            }
+            return sum;
+        }
+
+        [[nodiscard]] aoc::Answer sum_powers() const noexcept {
+            const auto& [ids, offsets, set_red, set_green, set_blue, red, green, blue] = columns_;
+            aoc::Answer sum = 0;
+            for (std::size_t i = 0; i != ids.size(); i++) {
+                sum += aoc::Answer{red[i]} * green[i] * blue[i];
+            }
+            return sum;
+        }
+
+    private:
+        struct Columns {
+            std::span<const std::uint32_t> ids;
+            std::span<const std::uint32_t> offsets;  // one per game and one more: game i owns sets offsets[i] up to
+                                                     // offsets[i + 1]
+            std::span<const std::uint32_t> set_red;
+            std::span<const std::uint32_t> set_green;
+            std::span<const std::uint32_t> set_blue;
+            std::span<const std::uint32_t> red;  // the most of the colour that any set of the game shows
+            std::span<const std::uint32_t> green;
+            std::span<const std::uint32_t> blue;
+        };
+
+        // One colour at a time, so every pass streams through one set column and one game column; the maximum of a
+        // game is a plain loop over its contiguous sets with no data-dependent branch, which the compiler vectorises.
+        void reduce() {
+            const auto games = columns_.ids.size();
+            minimal_.resize(3 * games);
+
+            const auto most = [this, games](std::span<const std::uint32_t> sets, std::size_t index) {
+                const auto column = std::span(minimal_).subspan(index * games, games);
+                const auto offsets = columns_.offsets;
+                for (std::size_t game = 0; game != games; game++) {
+                    std::uint32_t maximum = 0;
+                    for (auto set = offsets[game]; set != offsets[game + 1]; set++) {
+                        maximum = std::max(maximum, sets[set]);
+                    }
+                    column[game] = maximum;
+                }
+                return column;
+            };
+            columns_.red = most(columns_.set_red, 0);
+            columns_.green = most(columns_.set_green, 1);
+            columns_.blue = most(columns_.set_blue, 2);
+        }
+
+        std::pmr::vector<std::uint32_t> ids_;
+        std::pmr::vector<std::uint32_t> offsets_;
+        std::pmr::vector<std::uint32_t> sets_;     // the three set columns, one after the other
+        std::pmr::vector<std::uint32_t> minimal_;  // and the three per-game maxima
+        Columns columns_;
+    };
+
+
+    // How many games a bag makes possible and the sum of their ids.
+    struct PossibleGames {
+        std::uint64_t count = 0;
+        std::uint64_t id_sum = 0;
+
+        PossibleGames& operator+=(const PossibleGames& other) noexcept {
+            count += other.count;
+            id_sum += other.id_sum;
+            return *this;
+        }
+    };
+
+    // Answers "which games are possible with this bag" for a whole batch of bags at once. A game is possible when
+    // its minimal set is at most the bag in every colour, a three-way dominance question: the bags are swept by red
+    // while the games with at most that much red go into a two-dimensional Fenwick tree over the green and blue
+    // counts, so every bag costs two logarithms instead of a pass over all games. Counts are ranked among the
+    // distinct ones of the games, which keeps the tree as small as the number of green times blue counts.
+    class BagQueryIndex {
+    public:
+        explicit BagQueryIndex(const GameStore& games) {
+            const auto distinct = [](std::span<const std::uint32_t> column) {
+                std::vector<std::uint32_t> values(column.begin(), column.end());
+                std::ranges::sort(values);
+                values.erase(std::unique(values.begin(), values.end()), values.end());
+                return values;
+            };
+            green_values_ = distinct(games.green());
+            blue_values_ = distinct(games.blue());
+            if ((green_values_.size() + 1) * (blue_values_.size() + 1) > MaxCells) {
+                throw std::invalid_argument("too many distinct cube counts to index the games");
+            }
+
+            std::vector<std::uint32_t> by_red(games.size());
+            std::iota(by_red.begin(), by_red.end(), std::uint32_t{0});
+            std::ranges::sort(by_red, {}, [&games](std::uint32_t game) { return games.red()[game]; });
+
+            entries_.reserve(games.size());
+            for (const auto game : by_red) {
+                entries_.push_back(Entry{
+                    .red = games.red()[game],
+                    .green_rank = rank(green_values_, games.green()[game]),
+                    .blue_rank = rank(blue_values_, games.blue()[game]),
+                    .id = games.ids()[game],
+                });
+            }
+        }
+
+        // The answer for every bag, in the order of `bags`.
+        [[nodiscard]] std::vector<PossibleGames> answer(std::span<const Cubes> bags) const {
+            std::vector<std::uint32_t> by_red(bags.size());
+            std::iota(by_red.begin(), by_red.end(), std::uint32_t{0});
+            std::ranges::sort(by_red, {}, [bags](std::uint32_t bag) { return bags[bag].red; });
+
+            const auto width = blue_values_.size() + 1;
+            std::vector<PossibleGames> tree((green_values_.size() + 1) * width);
+            std::vector<PossibleGames> answers(bags.size());
+
+            std::size_t next = 0;
+            for (const auto index : by_red) {
+                const auto& bag = bags[index];
+                for (; next != entries_.size() && entries_[next].red <= bag.red; next++) {
+                    const auto& entry = entries_[next];
+                    const PossibleGames game{.count = 1, .id_sum = entry.id};
+                    for (auto g = entry.green_rank; g <= green_values_.size(); g += g & (~g + 1)) {
+                        for (auto b = entry.blue_rank; b <= blue_values_.size(); b += b & (~b + 1)) {
+                            tree[g * width + b] += game;
+                        }
+                    }
+                }
+
+                // the ranks of the largest counts the bag still holds
+                const auto green = std::ranges::upper_bound(green_values_, bag.green) - green_values_.begin();
+                const auto blue = std::ranges::upper_bound(blue_values_, bag.blue) - blue_values_.begin();
+                auto& answer = answers[index];
+                for (auto g = static_cast<std::size_t>(green); g != 0; g &= g - 1) {
+                    for (auto b = static_cast<std::size_t>(blue); b != 0; b &= b - 1) {
+                        answer += tree[g * width + b];
+                    }
+                }
+            }
+
+            return answers;
+        }
+
+    private:
+        static constexpr std::size_t MaxCells = std::size_t{1} << 24;
+
+        struct Entry {
+            std::uint32_t red = 0;
+            std::size_t green_rank = 0;  // 1-based, as the tree indexes
+            std::size_t blue_rank = 0;
+            std::uint32_t id = 0;
+        };
+
+        static std::size_t rank(const std::vector<std::uint32_t>& values, std::uint32_t value) {
+            return static_cast<std::size_t>(std::ranges::lower_bound(values, value) - values.begin()) + 1;
+        }
+
+    private:
+        std::vector<std::uint32_t> green_values_;
+        std::vector<std::uint32_t> blue_values_;
+        std::vector<Entry> entries_;  // the games by increasing red, with their ranks
+    };
+
+    // "red green blue"
+    Cubes parse_bag(std::string_view line) {
+        std::array<std::uint32_t, 3> counts{};
+        if (io::parse_integers<std::uint32_t>(line, counts) != counts.size()) {
+            throw std::invalid_argument("a bag needs a red, a green and a blue count");
+        }
+        return Cubes{.red = counts[0], .green = counts[1], .blue = counts[2]};
+    }
+
+
+    class CubeConundrum final : public aoc::Solution, public aoc::StreamingSolution, public aoc::SnapshotSolution {
+    public:
+        static inline const Bag BagConfiguration{{
+            .red = 12,
+            .green = 13,
+            .blue = 14,
+        }};
+
+        void parse(std::string_view input) override {
+            games_.parse(input);
+        }
+
+        void save(io::SnapshotWriter& out) const override {
+            games_.save(out);
+        }
+
+        void load(const io::Snapshot& in) override {
+            games_.load(in);
+        }
+
+        [[nodiscard]] aoc::Answer solve(aoc::Part part) override {
+            if (part == aoc::Part::ONE) {
+                return games_.sum_possible_ids(BagConfiguration.cubes);
+            }
+            return games_.sum_powers();
+        }
+
+        [[nodiscard]] aoc::Answer solve_stream(io::StreamReader& input, aoc::Part part) override {
+            aoc::Answer result = 0;
+
+            std::string_view record;
+            while (input.next(record)) {
+                if (record.empty()) {
+                    continue;
+                }
+                Cubes minimal;
+                const auto id =
+                    parse_game_record(record, [&minimal](const Cubes& set) { minimal = most(minimal, set); });
+                if (part == aoc::Part::ONE) {
+                    result += minimal <= BagConfiguration.cubes ? id : 0;
+                } else {
+                    result += power(minimal);
+                }
+            }
+            return result;
+        }
+
+    private:
+        GameStore games_{arena()};
+    };
+}  // namespace
+
+
+namespace year2023 {
+    std::string answer_bag_queries(std::string_view records, std::string_view bags) {
+        GameStore games(std::pmr::get_default_resource());
+        games.parse(records);
+
+        const auto queries = core::map_lines(bags, parse_bag);
+        const auto answers = BagQueryIndex(games).answer(queries);
+
+        std::string out;
+        out.reserve(answers.size() * 16);
+        for (const auto& answer : answers) {
+            out += std::to_string(answer.count);
+            out += ' ';
+            out += std::to_string(answer.id_sum);
+            out += '\n';
+        }
+        return out;
+    }
+
+    aoc::Puzzle cube_conundrum() {
+        auto puzzle = aoc::make_puzzle<CubeConundrum>(2, "cube-conundrum", aoc::Part::TWO);
+        puzzle.version = 3;  // snapshots hold the set columns and their offsets besides the per-game maxima
+        return puzzle;
+    }
+}  // namespace year2023
@@ -0,0 +1,84 @@
+#include <cstddef>
+#include <memory_resource>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+#include <common/grid.hpp>
+#include <common/puzzle.hpp>
+
+
+namespace {
+    class Garden {
+    private:
+        static constexpr char ROCK = '#';
+        static constexpr char PLAYER = 'S';
+        static constexpr char OUTSIDE = ROCK;
+
+    public:
+        static Garden load(std::string_view document, std::pmr::memory_resource* memory) {
+            return Garden(core::load_grid(document, OUTSIDE, memory), memory);
+        }
+
+        // Every plot reachable in exactly `steps` steps, found by stepping the whole set of positions at once: a
+        // plot is occupied after a step when it is open and one of its neighbours was occupied before.
+        [[nodiscard]] std::size_t count_end_plots(std::size_t steps) const {
+            auto current = core::BitGrid(map_.rows(), map_.cols(), memory_);
+            current.set(map_.row_of(start_), map_.col_of(start_));
+
+            auto next = core::BitGrid(map_.rows(), map_.cols(), memory_);
+            while (steps--) {
+                next.step(current, open_);
+                std::swap(current, next);
+            }
+            return current.count();
+        }
+
+    private:
+        Garden(core::Grid<char> map, std::pmr::memory_resource* memory)
+            : map_(std::move(map))
+            , open_(core::BitGrid::select(map_, ROCK, memory))
+            , memory_(memory) {
+            const auto start = map_.find(PLAYER);
+            if (!start) {
+                throw std::invalid_argument("the map is invalid");
+            }
+            start_ = *start;
+            open_.invert();
+        }
+
+    private:
+        core::Grid<char> map_;
+        core::BitGrid open_;
+        core::Grid<char>::Index start_ = 0;
+        std::pmr::memory_resource* memory_;
+    };
+
+
+    class StepCounter final : public aoc::Solution {
+    public:
+        static constexpr std::size_t STEPS = 64;
+
+        void parse(std::string_view input) override {
+            garden_.emplace(Garden::load(input, arena()));
+        }
+
+        [[nodiscard]] aoc::Answer solve(aoc::Part part) override {
+            if (part != aoc::Part::ONE) {
+                throw aoc::UnsolvedPart(part);
+            }
+            return garden_->count_end_plots(STEPS);
+        }
+
+    private:
+        std::optional<Garden> garden_;
+    };
+}  // namespace
+
+
+namespace year2023 {
+    aoc::Puzzle step_counter() {
+        return aoc::make_puzzle<StepCounter>(21, "step-counter", aoc::Part::ONE);
+    }
+}  // namespace year2023
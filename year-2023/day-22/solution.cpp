@@ -0,0 +1,96 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <memory_resource>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <common/io.hpp>
+#include <common/puzzle.hpp>
+#include <common/snapshot.hpp>
+
+
+namespace {
+    struct Point {
+        std::int32_t x = 0;
+        std::int32_t y = 0;
+        std::int32_t z = 0;
+    };
+
+    struct Brick {
+        std::array<Point, 2> points;
+    };
+
+    Point parse_point(io::Scanner& scanner) {
+        Point point;
+        point.x = scanner.number<std::int32_t>();
+        scanner.expect(',');
+        point.y = scanner.number<std::int32_t>();
+        scanner.expect(',');
+        point.z = scanner.number<std::int32_t>();
+        return point;
+    }
+
+    // 1,0,1~1,2,1
+    Brick parse_brick(std::string_view line, std::size_t line_number) {
+        io::Scanner scanner(line, line_number);
+
+        Brick brick;
+        brick.points[0] = parse_point(scanner);
+        scanner.expect('~');
+        brick.points[1] = parse_point(scanner);
+        scanner.expect_end();
+        return brick;
+    }
+
+    std::pmr::vector<Brick> load_bricks(std::string_view document, std::pmr::memory_resource* memory) {
+        std::pmr::vector<Brick> bricks(memory);
+        std::size_t line_number = 0;
+        for (const auto line : io::lines(document)) {
+            bricks.push_back(parse_brick(line, ++line_number));
+        }
+        return bricks;
+    }
+
+
+    class SandSlabs final : public aoc::Solution, public aoc::SnapshotSolution {
+    public:
+        void parse(std::string_view input) override {
+            parsed_ = load_bricks(input, arena());
+            bricks_ = parsed_;
+        }
+
+        void save(io::SnapshotWriter& out) const override {
+            out.add(bricks_);
+        }
+
+        void load(const io::Snapshot& in) override {
+            bricks_ = in.section<Brick>(0);
+        }
+
+        // Settling the bricks is not implemented yet; refusing keeps a made-up answer out of the cache and reports.
+        [[nodiscard]] aoc::Answer solve(aoc::Part part) override {
+            throw aoc::UnsolvedPart(part);
+        }
+
+    private:
+        std::pmr::vector<Brick> parsed_{arena()};
+        std::span<const Brick> bricks_;  // the parsed bricks or a snapshot of them
+    };
+}  // namespace
+
+
+namespace year2023 {
+    aoc::Puzzle sand_slabs() {
+        return aoc::make_puzzle<SandSlabs>(22, "sand-slabs", aoc::Part::ONE);
+    }
+}  // namespace year2023
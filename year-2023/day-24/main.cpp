@@ -1,36 +1,10 @@
-#include <fstream>
-#include <functional>
-#include <iostream>
-#include <set>
-#include <stdexcept>
-#include <string>
-#include <vector>
+#include <common/puzzle.hpp>
 
-namespace io {
-    template<typename T>
-    T read(std::istream& input) {
-        T value{};
-        input >> value;
-        return value;
-    }
+namespace year2023 {
+    aoc::Puzzle never_tell_me_the_odds();
+}  // namespace year2023
 
-    template<typename T>
-    std::vector<T> read(std::istream& input, std::size_t count) {
-        std::vector<T> result;
 
-        result.reserve(count);
-        while (count--) {
-            auto value = read<T>(input);
-            result.emplace_back(std::move(value));
-        }
-
-        return result;
-    }
-}  // namespace io
-
-
-int main() {
-    std::ifstream document(R"(/home/slovygin/work/fun/adventofcode/year-2023/day-23/test-data.txt)");
-    std::cout << "The result is " << 0 << std::endl;
-    return 0;
+int main(int argc, char** argv) {
+    return aoc::solve_puzzle(year2023::never_tell_me_the_odds(), argc, argv);
 }
@@ -0,0 +1,22 @@
+#include <string_view>
+
+#include <common/puzzle.hpp>
+
+
+namespace {
+    class NeverTellMeTheOdds final : public aoc::Solution {
+    public:
+        void parse(std::string_view) override {}
+
+        [[nodiscard]] aoc::Answer solve(aoc::Part part) override {
+            throw aoc::UnsolvedPart(part);
+        }
+    };
+}  // namespace
+
+
+namespace year2023 {
+    aoc::Puzzle never_tell_me_the_odds() {
+        return aoc::make_puzzle<NeverTellMeTheOdds>(24, "never-tell-me-the-odds", aoc::Part::ONE);
+    }
+}  // namespace year2023
@@ -0,0 +1,168 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+#include <common/grid.hpp>
+#include <common/numbers.hpp>
+#include <common/puzzle.hpp>
+
+
+namespace {
+    struct Scheme {
+    public:
+        static constexpr char EMPTY = '.';
+        static constexpr char GEAR = '*';
+
+        using Index = core::Grid<char>::Index;
+        using Label = std::uint32_t;  // 0 for a cell outside every number
+
+        explicit Scheme(std::pmr::memory_resource* memory)
+            : data_(memory)
+            , labels_(memory)
+            , values_(memory) {}
+
+        // The border around the scheme is empty, so every neighbour of a cell can be read without a bounds check.
+        // Every digit cell is then labelled with the number it belongs to, whose value is parsed this once.
+        static Scheme load_scheme(std::string_view document, std::pmr::memory_resource* memory) {
+            Scheme scheme(memory);
+            scheme.data_ = core::load_grid(document, EMPTY, memory);
+            scheme.label_numbers(memory);
+            return scheme;
+        }
+
+        // Numbers next to a symbol, each counted once however many symbols it touches.
+        [[nodiscard]] std::uint64_t sum_part_numbers() const {
+            std::vector<bool> is_part(values_.size());
+            for_each_symbol([this, &is_part](Index cell) {
+                for (const auto offset : data_.surrounding()) {
+                    is_part[labels_[neighbour(cell, offset)]] = true;
+                }
+            });
+
+            std::uint64_t sum = 0;
+            for (Label label = 1; label < values_.size(); label++) {
+                sum += is_part[label] ? values_[label] : 0;
+            }
+            return sum;
+        }
+
+        [[nodiscard]] std::uint64_t sum_gear_ratios() const {
+            std::uint64_t sum = 0;
+            for (std::size_t row = 0; row != data_.rows(); row++) {
+                const auto cells = data_.row(row);
+                const std::string_view line(cells.data(), cells.size());
+                const auto first = data_.index(static_cast<std::ptrdiff_t>(row), 0);
+
+                for (auto col = line.find(GEAR); col != std::string_view::npos; col = line.find(GEAR, col + 1)) {
+                    sum += gear_ratio(first + col);
+                }
+            }
+            return sum;
+        }
+
+    private:
+        void label_numbers(std::pmr::memory_resource* memory) {
+            labels_ = core::Grid<Label>(data_.rows(), data_.cols(), 0, memory);
+            values_.assign(1, 0);  // label 0 has no number
+
+            for (std::size_t row = 0; row != data_.rows(); row++) {
+                const auto cells = data_.row(row);
+                const std::string_view line(cells.data(), cells.size());
+                const auto first = data_.index(static_cast<std::ptrdiff_t>(row), 0);
+
+                auto col = io::find_first_digit(line);
+                while (col != std::string_view::npos) {
+                    // the border column ends every run
+                    const auto label = static_cast<Label>(values_.size());
+                    std::uint32_t value = 0;
+                    auto cell = first + col;
+                    for (; is_digit(data_[cell]); cell++) {
+                        value = value * 10 + static_cast<std::uint32_t>(data_[cell] - '0');
+                        labels_[cell] = label;
+                    }
+                    values_.push_back(value);
+
+                    col = cell - first;
+                    const auto next = io::find_first_digit(line.substr(col));
+                    col = next != std::string_view::npos ? col + next : next;
+                }
+            }
+        }
+
+        // The product of the two numbers next to `gear`, or 0 when it does not touch exactly two.
+        [[nodiscard]] std::uint64_t gear_ratio(Index gear) const {
+            // a number touches at most three cells of a row, so the 8 neighbours hold at most 6 numbers
+            std::array<Label, 8> numbers{};
+            std::size_t count = 0;
+            for (const auto offset : data_.surrounding()) {
+                const auto label = labels_[neighbour(gear, offset)];
+                const auto seen = numbers.begin() + static_cast<std::ptrdiff_t>(count);
+                if (label != 0 && std::find(numbers.begin(), seen, label) == seen) {
+                    numbers[count++] = label;
+                }
+            }
+            return count == 2 ? std::uint64_t{values_[numbers[0]]} * values_[numbers[1]] : 0;
+        }
+
+        // Calls `visit` with every cell holding a symbol, in reading order.
+        template<typename Visit>
+        void for_each_symbol(Visit visit) const {
+            for (std::size_t row = 0; row != data_.rows(); row++) {
+                auto cell = data_.index(static_cast<std::ptrdiff_t>(row), 0);
+                for (const auto symbol : data_.row(row)) {
+                    if (is_symbol(symbol)) {
+                        visit(cell);
+                    }
+                    cell++;
+                }
+            }
+        }
+
+        static Index neighbour(Index cell, std::ptrdiff_t offset) noexcept {
+            return static_cast<Index>(static_cast<std::ptrdiff_t>(cell) + offset);
+        }
+
+        static inline bool is_digit(char symbol) {
+            return symbol >= '0' && symbol <= '9';
+        }
+
+        static inline bool is_symbol(char symbol) {
+            return symbol != EMPTY && !is_digit(symbol);
+        }
+
+
+    private:
+        core::Grid<char> data_;
+        core::Grid<Label> labels_;               // the label of every cell, the border included
+        std::pmr::vector<std::uint32_t> values_;  // the value of every number, indexed by its label
+    };
+
+
+    class GearRatios final : public aoc::Solution {
+    public:
+        void parse(std::string_view input) override {
+            scheme_ = Scheme::load_scheme(input, arena());
+        }
+
+        [[nodiscard]] aoc::Answer solve(aoc::Part part) override {
+            if (part == aoc::Part::ONE) {
+                return scheme_.sum_part_numbers();
+            }
+            return scheme_.sum_gear_ratios();
+        }
+
+    private:
+        Scheme scheme_{arena()};
+    };
+}  // namespace
+
+
+namespace year2023 {
+    aoc::Puzzle gear_ratios() {
+        return aoc::make_puzzle<GearRatios>(3, "gear-ratios", aoc::Part::TWO);
+    }
+}  // namespace year2023
@@ -0,0 +1,161 @@
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory_resource>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include <common/io.hpp>
+#include <common/numbers.hpp>
+#include <common/parallel.hpp>
+#include <common/puzzle.hpp>
+#include <common/snapshot.hpp>
+
+
+namespace {
+    // The numbers of a card, as two sets of bits: every number on a card is below 100, so a set is two words and
+    // the matches of a card are a single AND away. Parsing a card builds the sets, solving only counts them.
+    struct Card {
+        static constexpr std::uint32_t NUMBER_LIMIT = 128;
+
+        std::array<std::uint64_t, 2> winning_numbers{};
+        std::array<std::uint64_t, 2> draft_numbers{};
+
+        [[nodiscard]] std::uint32_t count_matches() const noexcept {
+            return static_cast<std::uint32_t>(
+                std::popcount(winning_numbers[0] & draft_numbers[0])
+                + std::popcount(winning_numbers[1] & draft_numbers[1])
+            );
+        }
+    };
+
+    void add_numbers(std::string_view text, std::array<std::uint64_t, 2>& set) {
+        std::array<std::uint32_t, Card::NUMBER_LIMIT> numbers;
+        const auto count = io::parse_integers(text, std::span<std::uint32_t>(numbers));
+        for (const auto number : std::span(numbers).first(count)) {
+            if (number >= Card::NUMBER_LIMIT) {
+                throw std::invalid_argument("card number " + std::to_string(number) + " is out of range");
+            }
+            set[number / 64] |= std::uint64_t{1} << (number % 64);
+        }
+    }
+
+    Card load_card(std::string_view record) {
+        // Card 1: 41 48 83 86 17 | 83 86  6 31 17  9 48 53
+        const auto colon_pos = record.find(':');
+        const auto bar_pos = record.find('|', colon_pos);
+        if (colon_pos == std::string_view::npos || bar_pos == std::string_view::npos) {
+            throw std::invalid_argument("Invalid card record");
+        }
+
+        auto header = record.substr(0, colon_pos);
+        std::ignore = io::read<std::string_view>(header);
+        std::ignore = io::read<std::uint32_t>(header);
+
+        Card card;
+        add_numbers(record.substr(colon_pos + 1, bar_pos - colon_pos - 1), card.winning_numbers);
+        add_numbers(record.substr(bar_pos + 1), card.draft_numbers);
+        return card;
+    }
+
+    // Running count of scratchcards for part two. A card only hands copies to the next `matches` cards, so the
+    // copies still owed to the cards ahead are a window no longer than the largest match count.
+    class CardCounter {
+    public:
+        void add(std::size_t matches) {
+            std::uint64_t copies = 1;
+            if (!pending_.empty()) {
+                copies += pending_.front();
+                pending_.pop_front();
+            }
+            total_ += copies;
+
+            if (pending_.size() < matches) {
+                pending_.resize(matches, 0);
+            }
+            for (std::size_t i = 0; i != matches; i++) {
+                pending_[i] += copies;
+            }
+        }
+
+        [[nodiscard]] std::uint64_t total() const {
+            return total_;
+        }
+
+    private:
+        std::deque<std::uint64_t> pending_;
+        std::uint64_t total_ = 0;
+    };
+
+    std::uint64_t score(std::size_t matches) {
+        return matches == 0 ? 0 : std::uint64_t{1} << (matches - 1);
+    }
+
+
+    class Scratchcards final : public aoc::Solution, public aoc::StreamingSolution, public aoc::SnapshotSolution {
+    public:
+        void parse(std::string_view input) override {
+            parsed_ = core::map_lines(input, load_card, std::pmr::polymorphic_allocator<Card>(arena()));
+            cards_ = parsed_;
+        }
+
+        void save(io::SnapshotWriter& out) const override {
+            out.add(cards_);
+        }
+
+        void load(const io::Snapshot& in) override {
+            cards_ = in.section<Card>(0);
+        }
+
+        [[nodiscard]] aoc::Answer solve(aoc::Part part) override {
+            if (part == aoc::Part::ONE) {
+                return std::transform_reduce(cards_.begin(), cards_.end(), aoc::Answer{0}, std::plus{}, [](Card card) {
+                    return score(card.count_matches());
+                });
+            }
+
+            CardCounter counter;
+            for (const auto& card : cards_) {
+                counter.add(card.count_matches());
+            }
+            return counter.total();
+        }
+
+        [[nodiscard]] aoc::Answer solve_stream(io::StreamReader& input, aoc::Part part) override {
+            aoc::Answer score_sum = 0;
+            CardCounter counter;
+
+            std::string_view record;
+            while (input.next(record)) {
+                if (record.empty()) {
+                    continue;
+                }
+                const auto matches = load_card(record).count_matches();
+                score_sum += score(matches);
+                counter.add(matches);
+            }
+            return part == aoc::Part::ONE ? score_sum : counter.total();
+        }
+
+    private:
+        std::pmr::vector<Card> parsed_{arena()};
+        std::span<const Card> cards_;  // in input order, parsed or from a snapshot
+    };
+}  // namespace
+
+
+namespace year2023 {
+    aoc::Puzzle scratchcards() {
+        auto puzzle = aoc::make_puzzle<Scratchcards>(4, "scratchcards", aoc::Part::TWO);
+        puzzle.version = 2;  // snapshots hold the number sets of the cards instead of their match counts
+        return puzzle;
+    }
+}  // namespace year2023
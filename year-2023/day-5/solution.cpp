@@ -0,0 +1,266 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <common/io.hpp>
+#include <common/numbers.hpp>
+#include <common/puzzle.hpp>
+#include <common/snapshot.hpp>
+
+#include "embedded_data.hpp"
+
+
+namespace {
+    struct SeedInfo {
+        std::uint64_t id = 0;
+        std::uint64_t soil = 0;
+        std::uint64_t fertilizer = 0;
+        std::uint64_t water = 0;
+        std::uint64_t light = 0;
+        std::uint64_t temperature = 0;
+        std::uint64_t humidity = 0;
+        std::uint64_t location = 0;
+    };
+
+    using FieldPtr = std::uint64_t SeedInfo::*;
+    using Interval = std::pair<std::uint64_t, std::uint64_t>;
+
+    // Source values [first, last] map onto destination + (value - first).
+    struct MapRange {
+        std::uint64_t first = 0;
+        std::uint64_t last = 0;
+        std::uint64_t destination = 0;
+    };
+
+    class Mapper {
+    public:
+        constexpr Mapper(FieldPtr from, FieldPtr to)
+            : from_(from)
+            , to_(to) {}
+
+        constexpr void load_table(io::LineReader& in) {
+            std::string_view data_line;
+            while (in.next(data_line) && !data_line.empty()) {
+                std::array<std::uint64_t, 3> entry{};
+                if (std::is_constant_evaluated()) {
+                    // the batch parser is vectorised and cannot run at compile time
+                    for (auto& value : entry) {
+                        value = io::read<std::uint64_t>(data_line);
+                    }
+                } else if (io::parse_integers(data_line, std::span<std::uint64_t>(entry)) != entry.size()) {
+                    throw std::invalid_argument("invalid map entry");
+                }
+
+                const auto [dest_start, src_start, range_size] = entry;
+                table_.push_back(MapRange{
+                    .first = src_start,
+                    .last = src_start + range_size - 1,
+                    .destination = dest_start,
+                });
+            }
+        }
+
+        constexpr void lookup(std::vector<SeedInfo>& seeds) const {
+            for (auto& seed : seeds) {
+                const auto from = seed.*from_;
+                const auto it = std::find_if(table_.cbegin(), table_.cend(), [&from](const MapRange& range) {
+                    return range.first <= from && from <= range.last;
+                });
+                if (it == table_.cend()) {
+                    seed.*to_ = from;
+                } else {
+                    seed.*to_ = it->destination + from - it->first;
+                }
+            }
+        }
+
+        [[nodiscard]] const std::vector<MapRange>& table() const {
+            return table_;
+        }
+
+        void assign_table(std::span<const MapRange> table) {
+            table_.assign(table.begin(), table.end());
+        }
+
+    private:
+        std::vector<MapRange> table_;
+        FieldPtr from_;
+        FieldPtr to_;
+    };
+
+
+    // The seed-to-soil map of the test data, straight from the puzzle text.
+    static_assert([] {
+        io::LineReader reader(embedded::test_data);
+        std::string_view line;
+        while (reader.next(line) && line != "seed-to-soil map:") {
+        }
+
+        Mapper mapper(&SeedInfo::id, &SeedInfo::soil);
+        mapper.load_table(reader);
+
+        std::vector<SeedInfo> seeds{{.id = 79}, {.id = 14}, {.id = 55}, {.id = 13}};
+        mapper.lookup(seeds);
+        return seeds[0].soil == 81 && seeds[1].soil == 14 && seeds[2].soil == 57 && seeds[3].soil == 13;
+    }());
+
+
+    struct Almanac {
+        std::vector<Interval> seeds_rages;
+        std::unordered_map<std::string, Mapper> mappers;
+    };
+
+    // The mappers in the order a seed goes through them.
+    constexpr std::array<std::string_view, 7> MapperChain{
+        "seed-to-soil",
+        "soil-to-fertilizer",
+        "fertilizer-to-water",
+        "water-to-light",
+        "light-to-temperature",
+        "temperature-to-humidity",
+        "humidity-to-location",
+    };
+
+    std::unordered_map<std::string, Mapper> make_mappers() {
+        return {
+            {"seed-to-soil", Mapper(&SeedInfo::id, &SeedInfo::soil)},
+            {"soil-to-fertilizer", Mapper(&SeedInfo::soil, &SeedInfo::fertilizer)},
+            {"fertilizer-to-water", Mapper(&SeedInfo::fertilizer, &SeedInfo::water)},
+            {"water-to-light", Mapper(&SeedInfo::water, &SeedInfo::light)},
+            {"light-to-temperature", Mapper(&SeedInfo::light, &SeedInfo::temperature)},
+            {"temperature-to-humidity", Mapper(&SeedInfo::temperature, &SeedInfo::humidity)},
+            {"humidity-to-location", Mapper(&SeedInfo::humidity, &SeedInfo::location)},
+        };
+    }
+
+    Almanac load_almanac(std::string_view plan_document) {
+        io::LineReader reader(plan_document);
+
+        auto line = io::read_line(reader);
+        if (io::read<std::string_view>(line) != "seeds:") {
+            throw std::invalid_argument("invalid input steam");
+        }
+
+        const auto seeds_numbers = io::parse_integers<std::uint64_t>(line);
+        if (seeds_numbers.size() % 2 != 0) {
+            throw std::invalid_argument("invalid input steam");
+        }
+
+        Almanac almanac;
+        for (auto i = 0u; i != seeds_numbers.size(); i += 2) {
+            almanac.seeds_rages.emplace_back(seeds_numbers[i], seeds_numbers[i + 1]);
+        }
+
+        almanac.mappers = make_mappers();
+
+        while (reader.next(line)) {
+            static constexpr std::string_view MapSuffix = "map:";
+            if (line.ends_with(MapSuffix)) {
+                const auto name = line.substr(0, line.size() - (MapSuffix.size() + 1));
+                auto& mapper = almanac.mappers.at(std::string(name));
+                mapper.load_table(reader);
+            }
+        }
+
+        return almanac;
+    }
+
+    std::uint64_t find_nearest_location(const Almanac& almanac) {
+        const auto& seeds_rages = almanac.seeds_rages;
+        const auto& mappers = almanac.mappers;
+
+        std::vector<std::uint64_t> min_locations;
+        std::transform(
+            seeds_rages.cbegin(), seeds_rages.cend(), std::back_inserter(min_locations),
+            [&mappers](const Interval& pair) {
+                std::vector<SeedInfo> seeds;
+                for (std::uint64_t i = 0; i != pair.second; i++) {
+                    seeds.push_back(SeedInfo{.id = pair.first + i});
+                }
+
+                for (const auto name : MapperChain) {
+                    mappers.at(std::string(name)).lookup(seeds);
+                }
+
+                return std::min_element(seeds.cbegin(), seeds.cend(), [](const SeedInfo& lhs, const SeedInfo& rhs) {
+                    return lhs.location < rhs.location;
+                })->location;
+            }
+        );
+
+        return *std::min_element(min_locations.cbegin(), min_locations.cend());
+    }
+
+
+    class GardenCalculator final : public aoc::Solution, public aoc::SnapshotSolution {
+    public:
+        void parse(std::string_view input) override {
+            almanac_ = load_almanac(input);
+        }
+
+        // Section 0 holds the seed ranges as (start, length) pairs, then one section per mapper of the chain.
+        void save(io::SnapshotWriter& out) const override {
+            std::vector<std::uint64_t> seeds;
+            for (const auto& [start, length] : almanac_.seeds_rages) {
+                seeds.push_back(start);
+                seeds.push_back(length);
+            }
+            out.add(seeds);
+
+            for (const auto name : MapperChain) {
+                out.add(almanac_.mappers.at(std::string(name)).table());
+            }
+        }
+
+        // The tables are a few dozen ranges, they are copied out rather than viewed.
+        void load(const io::Snapshot& in) override {
+            const auto seeds = in.section<std::uint64_t>(0);
+            if (seeds.size() % 2 != 0) {
+                throw std::invalid_argument("invalid snapshot: the seeds are not start and length pairs");
+            }
+            almanac_.seeds_rages.clear();
+            for (std::size_t i = 0; i != seeds.size(); i += 2) {
+                almanac_.seeds_rages.emplace_back(seeds[i], seeds[i + 1]);
+            }
+
+            almanac_.mappers = make_mappers();
+            for (std::size_t i = 0; i != MapperChain.size(); i++) {
+                almanac_.mappers.at(std::string(MapperChain[i])).assign_table(in.section<MapRange>(i + 1));
+            }
+        }
+
+        [[nodiscard]] aoc::Answer solve(aoc::Part part) override {
+            if (part != aoc::Part::TWO) {
+                throw aoc::UnsolvedPart(part);
+            }
+            return find_nearest_location(almanac_);
+        }
+
+    private:
+        Almanac almanac_;
+    };
+}  // namespace
+
+
+namespace year2023 {
+    aoc::Puzzle garden_calculator() {
+        auto puzzle = aoc::make_puzzle<GardenCalculator>(5, "garden-calculator", aoc::Part::TWO);
+        puzzle.slow = true;  // part two maps every seed of every range one by one
+        return puzzle;
+    }
+}  // namespace year2023
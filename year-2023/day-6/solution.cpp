@@ -0,0 +1,234 @@
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <common/io.hpp>
+#include <common/puzzle.hpp>
+
+#include "embedded_data.hpp"
+
+
+namespace {
+    namespace core {
+        template<typename Integer>
+        class number_iterator {
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = Integer;
+            using difference_type = Integer;
+            using pointer = Integer*;
+            using reference = Integer&;
+
+            constexpr explicit number_iterator(value_type current)
+                : current_(current) {}
+
+            constexpr value_type operator*() const {
+                return current_;
+            }
+
+            constexpr number_iterator& operator++() {
+                ++current_;
+                return *this;
+            }
+
+            constexpr number_iterator operator++(int) {
+                number_iterator temp = *this;
+                ++(*this);
+                return temp;
+            }
+
+            constexpr number_iterator& operator--() {
+                --current_;
+                return *this;
+            }
+
+            constexpr number_iterator operator--(int) {
+                number_iterator temp = *this;
+                --(*this);
+                return temp;
+            }
+
+            constexpr number_iterator& operator+=(value_type n) {
+                current_ += n;
+                return *this;
+            }
+
+            constexpr number_iterator& operator-=(value_type n) {
+                current_ -= n;
+                return *this;
+            }
+
+            constexpr difference_type operator-(const number_iterator& other) const {
+                return current_ - other.current_;
+            }
+
+            friend constexpr number_iterator operator+(number_iterator it, value_type n) {
+                return (it += n);
+            }
+
+            friend constexpr number_iterator operator-(number_iterator it, value_type n) {
+                return (it += n);
+            }
+
+            constexpr int operator[](value_type n) const {
+                return current_ + n;
+            }
+
+        public:
+            // Comparison operators
+            constexpr bool operator==(const number_iterator& other) const {
+                return current_ == other.current_;
+            }
+            constexpr bool operator!=(const number_iterator& other) const {
+                return current_ != other.current_;
+            }
+            constexpr bool operator<(const number_iterator& other) const {
+                return current_ < other.current_;
+            }
+            constexpr bool operator>(const number_iterator& other) const {
+                return current_ > other.current_;
+            }
+            constexpr bool operator<=(const number_iterator& other) const {
+                return current_ <= other.current_;
+            }
+            constexpr bool operator>=(const number_iterator& other) const {
+                return current_ >= other.current_;
+            }
+
+        private:
+            value_type current_;
+        };
+
+        template<typename Integer>
+        constexpr number_iterator<Integer> make_number_iterator(Integer value) {
+            return number_iterator<Integer>(value);
+        }
+    }  // namespace core
+
+    struct RaceRecord {
+        std::size_t duration = 0;
+        std::size_t distance = 0;
+    };
+
+    std::vector<RaceRecord> load_races_records(std::string_view document) {
+        io::LineReader reader(document);
+        const auto durations = io::read_sequence<std::size_t>(reader, true);
+        const auto distances = io::read_sequence<std::size_t>(reader, true);
+        if (durations.empty() || durations.size() != distances.size()) {
+            throw std::invalid_argument("input data is corrupted");
+        }
+
+        std::vector<RaceRecord> records;
+        records.reserve(durations.size());
+        for (auto i = 0u; i != durations.size(); i++) {
+            records.emplace_back(durations[i], distances[i]);
+        }
+        return records;
+    }
+
+    constexpr RaceRecord load_race_record(std::string_view document) {
+        io::LineReader reader(document);
+        const auto duration_line = io::read_line(reader);
+        const auto distances_line = io::read_line(reader);
+
+        const auto to_number = [](std::string_view line, std::string_view prefix_to_ignore) {
+            if (!line.starts_with(prefix_to_ignore)) {
+                throw std::invalid_argument("input data is corrupted");
+            }
+            line.remove_prefix(prefix_to_ignore.size());
+
+            // the digits are split by blanks (kerning), so glue them back together
+            std::size_t number = 0;
+            for (const auto symbol : line) {
+                if (symbol >= '0' && symbol <= '9') {
+                    number = number * 10 + static_cast<std::size_t>(symbol - '0');
+                } else if (!io::is_blank(symbol)) {
+                    throw std::invalid_argument("input data is corrupted");
+                }
+            }
+            return number;
+        };
+
+        return RaceRecord{
+            .duration = to_number(duration_line, "Time:"), .distance = to_number(distances_line, "Distance:")
+        };
+    }
+
+    constexpr std::size_t simulate_race(std::size_t charge_duration, std::size_t total_duration) {
+        const auto speed = charge_duration;
+        const auto travel_time = total_duration - charge_duration;
+        return speed * travel_time;
+    }
+
+    constexpr std::pair<std::size_t, std::size_t> min_max_charge_time(const RaceRecord& record) {
+        const auto start = core::make_number_iterator<std::size_t>(0);
+        const auto end = start + record.duration;
+        const auto it =
+            std::upper_bound(start, end, record.distance, [&record](std::size_t distance, std::size_t charge_time) {
+                return simulate_race(charge_time, record.duration) > distance;
+            });
+
+        return {*it, record.duration - *it};
+    }
+
+    constexpr std::size_t count_winning_variants(const RaceRecord& record) {
+        const auto [min, max] = min_max_charge_time(record);
+        return max - min + 1;
+    }
+
+    static_assert(count_winning_variants(RaceRecord{.duration = 7, .distance = 9}) == 4);
+    static_assert(count_winning_variants(load_race_record(embedded::test_data)) == 71503);
+
+
+    std::vector<std::pair<std::size_t, std::size_t>> determinate_winning_variants(const std::vector<RaceRecord>& records) {
+        std::vector<std::pair<std::size_t, std::size_t>> winning_variants;
+
+        std::transform(
+            records.cbegin(), records.cend(), std::back_inserter(winning_variants),
+            [](const RaceRecord& record) { return min_max_charge_time(record); }
+        );
+
+        return winning_variants;
+    }
+
+
+    class WaitForIt final : public aoc::Solution {
+    public:
+        void parse(std::string_view input) override {
+            races_records_ = load_races_records(input);
+            race_record_ = load_race_record(input);
+        }
+
+        [[nodiscard]] aoc::Answer solve(aoc::Part part) override {
+            if (part == aoc::Part::ONE) {
+                aoc::Answer product = 1;
+                for (const auto& [min, max] : determinate_winning_variants(races_records_)) {
+                    product *= max - min + 1;
+                }
+                return product;
+            }
+
+            return count_winning_variants(race_record_);
+        }
+
+    private:
+        std::vector<RaceRecord> races_records_;
+        RaceRecord race_record_;
+    };
+}  // namespace
+
+
+namespace year2023 {
+    aoc::Puzzle wait_for_it() {
+        return aoc::make_puzzle<WaitForIt>(6, "wait-for-it", aoc::Part::TWO);
+    }
+}  // namespace year2023
@@ -0,0 +1,190 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <common/io.hpp>
+#include <common/parallel.hpp>
+#include <common/puzzle.hpp>
+
+#include "embedded_data.hpp"
+
+
+namespace {
+    namespace game {
+        enum class Card { JOKER, TWO, THREE, FOUR, FIVE, SIX, SEVEN, EIGHT, NINE, TEN, QUEEN, KING, ACE };
+
+        enum class Combination { ONE, PAIR, TWO_PAIR, THREE, FULL_HOUSE, FOUR, FIVE };
+
+        constexpr std::size_t HAND_SIZE = 5;
+        using Hand = std::array<Card, HAND_SIZE>;
+
+        constexpr Card read_card(char card) {
+            switch (card) {
+                case '2': return Card::TWO;
+                case '3': return Card::THREE;
+                case '4': return Card::FOUR;
+                case '5': return Card::FIVE;
+                case '6': return Card::SIX;
+                case '7': return Card::SEVEN;
+                case '8': return Card::EIGHT;
+                case '9': return Card::NINE;
+                case 'T': return Card::TEN;
+                case 'J': return Card::JOKER;
+                case 'Q': return Card::QUEEN;
+                case 'K': return Card::KING;
+                case 'A': return Card::ACE;
+                default: throw std::invalid_argument("unknown card");
+            }
+        }
+
+        constexpr Hand read_hand(std::string_view hand_str) {
+            if (hand_str.size() != HAND_SIZE) {
+                throw std::invalid_argument("invalid hand");
+            }
+
+            Hand hand{};
+            std::transform(hand_str.cbegin(), hand_str.cend(), hand.begin(), read_card);
+            return hand;
+        }
+
+        constexpr Combination determine_combination(const Hand& hand) {
+            std::array<std::size_t, static_cast<std::size_t>(Card::ACE) + 1> counts{};
+            for (auto&& card : hand) {
+                counts[static_cast<std::size_t>(card)]++;
+            }
+
+            // jokers join the most frequent of the other cards
+            const auto jokers = std::exchange(counts[static_cast<std::size_t>(Card::JOKER)], 0);
+            *std::max_element(counts.begin(), counts.end()) += jokers;
+
+            const auto kinds = static_cast<std::size_t>(std::count_if(counts.cbegin(), counts.cend(), [](auto count) {
+                return count != 0;
+            }));
+            const auto largest = *std::max_element(counts.cbegin(), counts.cend());
+
+            if (kinds == 1) {
+                return Combination::FIVE;
+            }
+
+            if (kinds == 2) {
+                return largest == 4 ? Combination::FOUR : Combination::FULL_HOUSE;
+            }
+
+            if (kinds == 3) {
+                return largest == 3 ? Combination::THREE : Combination::TWO_PAIR;
+            }
+
+            return (kinds == 4) ? Combination::PAIR : Combination::ONE;
+        }
+
+        static_assert(determine_combination(read_hand("32T3K")) == Combination::PAIR);
+        static_assert(determine_combination(read_hand("KTJJT")) == Combination::FOUR);
+        static_assert(determine_combination(read_hand("JJJJJ")) == Combination::FIVE);
+
+        struct Player {
+            constexpr Player()
+                : hand_()
+                , bid_(0)
+            {
+            }
+
+            constexpr const Hand& hand() const {
+                return hand_;
+            }
+
+            constexpr std::size_t bid() const {
+                return bid_;
+            }
+
+            constexpr Combination combo() const {
+                return combo_;
+            }
+
+            static constexpr Player load(std::string_view record) {
+                Player player;
+                player.hand_ = read_hand(io::read<std::string_view>(record));
+                player.bid_ = io::read<std::size_t>(record);
+                player.combo_ = determine_combination(player.hand_);
+                return player;
+            }
+
+        private:
+            Hand hand_;
+            std::size_t bid_;
+            Combination combo_ = Combination::ONE;  // worked out once while loading, sorting compares it a lot
+        };
+
+    }  // namespace game
+
+
+    constexpr std::vector<game::Player> load_players(std::string_view document) {
+        std::vector<game::Player> players;
+        for (const auto record : io::lines(document)) {
+            if (!record.empty()) {
+                players.emplace_back(game::Player::load(record));
+            }
+        }
+        return players;
+    }
+
+    constexpr std::vector<game::Player>& sort_by_rank(std::vector<game::Player>& players) {
+        std::sort(players.begin(), players.end(), [](const game::Player& lhs, const game::Player& rhs) {
+            if (lhs.combo() == rhs.combo()) {
+                return lhs.hand() < rhs.hand();
+            }
+
+            return lhs.combo() < rhs.combo();
+        });
+        return players;
+    }
+
+    constexpr std::uint64_t total_winnings(std::vector<game::Player>& players) {
+        sort_by_rank(players);
+
+        std::uint64_t result = 0;
+        for (auto i = 0u; i != players.size(); i++) {
+            result += players[i].bid() * (i + 1);
+        }
+        return result;
+    }
+
+    static_assert([] {
+        auto players = load_players(embedded::test_data);
+        return total_winnings(players);
+    }() == 5905);
+
+
+    class CamelCards final : public aoc::Solution {
+    public:
+        void parse(std::string_view input) override {
+            // hands are read and rated independently, only the ranking needs all of them
+            players_ = core::map_lines(input, game::Player::load);
+        }
+
+        [[nodiscard]] aoc::Answer solve(aoc::Part part) override {
+            if (part != aoc::Part::TWO) {
+                throw aoc::UnsolvedPart(part);
+            }
+
+            return total_winnings(players_);
+        }
+
+    private:
+        std::vector<game::Player> players_;
+    };
+}  // namespace
+
+
+namespace year2023 {
+    aoc::Puzzle camel_cards() {
+        return aoc::make_puzzle<CamelCards>(7, "camel-cards", aoc::Part::TWO);
+    }
+}  // namespace year2023
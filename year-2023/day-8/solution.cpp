@@ -0,0 +1,208 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <common/graph.hpp>
+#include <common/io.hpp>
+#include <common/puzzle.hpp>
+
+
+namespace {
+    // Views into the input text, which outlives the parsed network.
+    struct NodeInfo {
+        std::string_view name;
+        std::string_view left_name;
+        std::string_view right_name;
+    };
+
+    // AAA = (BBB, CCC)
+    NodeInfo parse_node_data(std::string_view data, std::size_t line_number) {
+        io::Scanner scanner(data, line_number);
+
+        NodeInfo info;
+        info.name = scanner.word();
+        scanner.skip_blanks();
+        scanner.expect('=');
+        scanner.skip_blanks();
+        scanner.expect('(');
+        info.left_name = scanner.word();
+        scanner.expect(',');
+        scanner.skip_blanks();
+        info.right_name = scanner.word();
+        scanner.expect(')');
+        scanner.expect_end();
+        return info;
+    }
+
+    // Every node has exactly two successors in the graph: its left one first, then its right one.
+    class Network {
+    public:
+        explicit Network(std::pmr::memory_resource* memory)
+            : memory_(memory)
+            , names_(memory)
+            , graph_(memory) {}
+
+        const core::Interner& names() const {
+            return names_;
+        }
+
+        const core::Graph& graph() const {
+            return graph_;
+        }
+
+        // `direction` is 0 for left and 1 for right.
+        core::NodeId next(core::NodeId node, std::uint16_t direction) const {
+            return graph_.successors(node)[direction];
+        }
+
+    public:
+        friend io::LineReader& operator>>(io::LineReader& in, Network& network) {
+            core::GraphBuilder builder(network.memory_);
+
+            std::string_view data;
+            // the route and the blank line after it come first
+            for (std::size_t line_number = 3; in.next(data) && !data.empty(); line_number++) {
+                const auto info = parse_node_data(data, line_number);
+                builder.add_edge(info.name, info.left_name);
+                builder.add_edge(info.name, info.right_name);
+            }
+
+            network.graph_ = builder.build(network.memory_);
+            network.names_ = std::move(builder.names());
+
+            for (core::NodeId node = 0; node != network.graph_.size(); node++) {
+                if (network.graph_.degree(node) != 2) {
+                    const auto problem = network.graph_.degree(node) == 0 ? "' is never defined" : "' is defined twice";
+                    throw std::invalid_argument("node '" + std::string(network.names_.name(node)) + problem);
+                }
+            }
+
+            return in;
+        }
+
+    private:
+        std::pmr::memory_resource* memory_;
+        core::Interner names_;
+        core::Graph graph_;
+    };
+
+    std::vector<std::uint16_t> load_route(io::LineReader& document) {
+        std::string_view raw_route;
+        if (!document.next(raw_route)) {
+            throw std::invalid_argument("Invalid input stream");
+        }
+
+        std::vector<std::uint16_t> route(raw_route.size(), 0);
+        std::transform(raw_route.cbegin(), raw_route.cend(), route.begin(), [](char direction) {
+            return direction == 'L' ? 0 : 1;
+        });
+        document.next(raw_route);  // consume new line
+
+        return route;
+    }
+
+    core::NodeId find_node(const Network& network, std::string_view name) {
+        const auto node = network.names().find(name);
+        if (!node) {
+            throw std::invalid_argument("no node named '" + std::string(name) + "'");
+        }
+        return *node;
+    }
+
+    std::size_t calc_distance(
+        const Network& network, std::string_view from, std::string_view to, const std::vector<std::uint16_t>& route
+    ) {
+        std::size_t distance = 0;
+
+        auto current = find_node(network, from);
+        const auto target = find_node(network, to);
+        std::size_t route_idx = 0;
+        while (current != target) {
+            current = network.next(current, route[route_idx]);
+            route_idx = (route_idx + 1) % route.size();
+
+            distance++;
+        }
+        return distance;
+    }
+
+    using NamePredicate = std::function<bool(std::string_view name)>;
+
+    std::size_t calc_distance(
+        const Network& network, const NamePredicate& from, const NamePredicate& to,
+        const std::vector<std::uint16_t>& route
+    ) {
+        // the predicates are asked once per node up front, walking only compares ids and reads flags
+        std::vector<core::NodeId> currents;
+        std::vector<std::uint8_t> is_target(network.graph().size(), 0);
+        for (core::NodeId node = 0; node != network.graph().size(); node++) {
+            const auto name = network.names().name(node);
+            if (from(name)) {
+                currents.push_back(node);
+            }
+            is_target[node] = to(name) ? 1 : 0;
+        }
+
+        const auto is_done = [&currents, &is_target]() {
+            return std::all_of(currents.cbegin(), currents.cend(), [&is_target](core::NodeId node) {
+                return is_target[node] != 0;
+            });
+        };
+
+        std::size_t distance = 0;
+        std::size_t route_idx = 0;
+        while (!is_done()) {
+            for (auto& node : currents) {
+                node = network.next(node, route[route_idx]);
+            }
+            route_idx = (route_idx + 1) % route.size();
+            distance++;
+        }
+        return distance;
+    }
+
+
+    class HauntedWasteland final : public aoc::Solution {
+    public:
+        void parse(std::string_view input) override {
+            io::LineReader reader(input);
+
+            route_ = load_route(reader);
+            reader >> network_;
+        }
+
+        [[nodiscard]] aoc::Answer solve(aoc::Part part) override {
+            if (part == aoc::Part::ONE) {
+                return calc_distance(network_, "AAA", "ZZZ", route_);
+            }
+
+            return calc_distance(
+                network_, [](std::string_view name) -> bool { return name.ends_with('A'); },
+                [](std::string_view name) -> bool { return name.ends_with('Z'); }, route_
+            );
+        }
+
+    private:
+        std::vector<std::uint16_t> route_;
+        Network network_{arena()};
+    };
+}  // namespace
+
+
+namespace year2023 {
+    aoc::Puzzle haunted_wasteland() {
+        auto puzzle = aoc::make_puzzle<HauntedWasteland>(8, "haunted-wasteland", aoc::Part::TWO);
+        puzzle.slow = true;  // part two walks every ghost in lockstep until they all stand on a target
+        return puzzle;
+    }
+}  // namespace year2023
@@ -0,0 +1,22 @@
+#include <string_view>
+
+#include <common/puzzle.hpp>
+
+
+namespace {
+    class MirageMaintenance final : public aoc::Solution {
+    public:
+        void parse(std::string_view) override {}
+
+        [[nodiscard]] aoc::Answer solve(aoc::Part part) override {
+            throw aoc::UnsolvedPart(part);
+        }
+    };
+}  // namespace
+
+
+namespace year2023 {
+    aoc::Puzzle mirage_maintenance() {
+        return aoc::make_puzzle<MirageMaintenance>(9, "mirage-maintenance", aoc::Part::ONE);
+    }
+}  // namespace year2023
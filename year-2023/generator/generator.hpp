@@ -0,0 +1,165 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+
+namespace generator {
+    struct Parameters {
+        std::uint64_t seed = 0;
+        std::size_t size = 0;  // the day's main scale knob (lines, nodes, columns, ...)
+        std::size_t rows = 0;  // grid height, only used by grid puzzles
+    };
+
+    class Random {
+    public:
+        explicit Random(std::uint64_t seed)
+            : engine_(seed) {}
+
+        // Uniform value in the closed range [low, high].
+        template<typename Integer>
+            requires std::integral<Integer>
+        Integer uniform(Integer low, Integer high) {
+            return std::uniform_int_distribution<Integer>(low, high)(engine_);
+        }
+
+        bool chance(double probability) {
+            return std::bernoulli_distribution(probability)(engine_);
+        }
+
+        template<typename T>
+        const T& pick(std::span<const T> items) {
+            return items[uniform<std::size_t>(0, items.size() - 1)];
+        }
+
+        char pick(std::string_view symbols) {
+            return symbols[uniform<std::size_t>(0, symbols.size() - 1)];
+        }
+
+        template<typename Container>
+        void shuffle(Container& items) {
+            std::shuffle(items.begin(), items.end(), engine_);
+        }
+
+    private:
+        std::mt19937_64 engine_;
+    };
+
+    // Buffered text sink: multi-gigabyte inputs are written in large blocks instead of through the stream per token.
+    class Writer {
+    public:
+        static constexpr std::size_t Capacity = std::size_t{1} << 20;
+
+        explicit Writer(std::ostream& out)
+            : out_(out) {
+            buffer_.reserve(Capacity + 64);
+        }
+
+        Writer(const Writer&) = delete;
+        Writer& operator=(const Writer&) = delete;
+        Writer(Writer&&) = delete;
+        Writer& operator=(Writer&&) = delete;
+
+        ~Writer() {
+            flush();
+        }
+
+        Writer& put(char symbol) {
+            buffer_.push_back(symbol);
+            return maybe_flush();
+        }
+
+        Writer& text(std::string_view text) {
+            buffer_.append(text);
+            return maybe_flush();
+        }
+
+        template<typename Integer>
+            requires std::integral<Integer>
+        Writer& number(Integer value) {
+            std::array<char, 24> digits{};
+            const auto [end, ec] = std::to_chars(digits.data(), digits.data() + digits.size(), value);
+            buffer_.append(std::string_view(digits.data(), end));
+            return maybe_flush();
+        }
+
+        // Right-aligned number padded with spaces to `width` characters.
+        template<typename Integer>
+            requires std::integral<Integer>
+        Writer& number(Integer value, std::size_t width) {
+            std::array<char, 24> digits{};
+            const auto [end, ec] = std::to_chars(digits.data(), digits.data() + digits.size(), value);
+            const auto length = static_cast<std::size_t>(end - digits.data());
+            if (length < width) {
+                buffer_.append(width - length, ' ');
+            }
+            buffer_.append(std::string_view(digits.data(), length));
+            return maybe_flush();
+        }
+
+        Writer& line(std::string_view text = {}) {
+            buffer_.append(text);
+            buffer_.push_back('\n');
+            return maybe_flush();
+        }
+
+        void flush() {
+            out_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+            buffer_.clear();
+        }
+
+    private:
+        Writer& maybe_flush() {
+            if (buffer_.size() >= Capacity) {
+                flush();
+            }
+            return *this;
+        }
+
+    private:
+        std::ostream& out_;
+        std::string buffer_;
+    };
+
+    // Short unique lowercase identifiers ("aa", "ab", ...) of the given minimal length.
+    std::vector<std::string> make_names(Random& random, std::size_t count, std::size_t min_length);
+
+    using Generate = void (*)(const Parameters& parameters, Random& random, Writer& out);
+
+    void trebuchet(const Parameters& parameters, Random& random, Writer& out);
+    void cube_conundrum(const Parameters& parameters, Random& random, Writer& out);
+    void gear_ratios(const Parameters& parameters, Random& random, Writer& out);
+    void scratchcards(const Parameters& parameters, Random& random, Writer& out);
+    void garden_calculator(const Parameters& parameters, Random& random, Writer& out);
+    void wait_for_it(const Parameters& parameters, Random& random, Writer& out);
+    void camel_cards(const Parameters& parameters, Random& random, Writer& out);
+    void haunted_wasteland(const Parameters& parameters, Random& random, Writer& out);
+    void mirage_maintenance(const Parameters& parameters, Random& random, Writer& out);
+    void pipe_maze(const Parameters& parameters, Random& random, Writer& out);
+    void cosmic_expansion(const Parameters& parameters, Random& random, Writer& out);
+    void hot_springs(const Parameters& parameters, Random& random, Writer& out);
+    void point_of_incidence(const Parameters& parameters, Random& random, Writer& out);
+    void parabolic_reflector_dish(const Parameters& parameters, Random& random, Writer& out);
+    void lens_library(const Parameters& parameters, Random& random, Writer& out);
+    void lava_floor(const Parameters& parameters, Random& random, Writer& out);
+    void clumsy_crucible(const Parameters& parameters, Random& random, Writer& out);
+    void lavaduct_lagoon(const Parameters& parameters, Random& random, Writer& out);
+    void aplenty(const Parameters& parameters, Random& random, Writer& out);
+    void pulse_propagation(const Parameters& parameters, Random& random, Writer& out);
+    void step_counter(const Parameters& parameters, Random& random, Writer& out);
+    void sand_slabs(const Parameters& parameters, Random& random, Writer& out);
+    void long_walk(const Parameters& parameters, Random& random, Writer& out);
+    void never_tell_me_the_odds(const Parameters& parameters, Random& random, Writer& out);
+    void snowverload(const Parameters& parameters, Random& random, Writer& out);
+}  // namespace generator
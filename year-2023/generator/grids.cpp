@@ -0,0 +1,436 @@
+#include "generator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+
+namespace generator {
+    namespace {
+        using Grid = std::vector<std::string>;
+
+        void write_grid(const Grid& grid, Writer& out) {
+            for (const auto& row : grid) {
+                out.line(row);
+            }
+        }
+
+        // Row-by-row grid of independent cells: nothing but one row is ever kept in memory.
+        template<typename Cell>
+        void write_cells(const Parameters& parameters, Writer& out, Cell&& cell) {
+            std::string row(parameters.size, '.');
+            for (std::size_t y = 0; y != parameters.rows; y++) {
+                for (std::size_t x = 0; x != row.size(); x++) {
+                    row[x] = cell(y, x);
+                }
+                out.line(row);
+            }
+        }
+
+        std::size_t make_odd(std::size_t value, std::size_t at_least) {
+            return std::max(value | 1U, at_least);
+        }
+
+        class DisjointSet {
+        public:
+            explicit DisjointSet(std::size_t size)
+                : parent_(size) {
+                std::iota(parent_.begin(), parent_.end(), 0);
+            }
+
+            std::size_t find(std::size_t item) {
+                while (parent_[item] != item) {
+                    parent_[item] = parent_[parent_[item]];
+                    item = parent_[item];
+                }
+                return item;
+            }
+
+            void unite(std::size_t lhs, std::size_t rhs) {
+                parent_[find(lhs)] = find(rhs);
+            }
+
+        private:
+            std::vector<std::size_t> parent_;
+        };
+
+        // Reflection line of a pattern: between columns (or rows) `position - 1` and `position`.
+        struct Axis {
+            bool vertical = true;
+            std::size_t position = 0;
+        };
+
+        std::optional<std::pair<std::size_t, std::size_t>> reflect(
+            const Axis& axis, std::size_t y, std::size_t x, std::size_t rows, std::size_t cols
+        ) {
+            auto& moved = axis.vertical ? x : y;
+            const auto limit = axis.vertical ? cols : rows;
+
+            const auto mirrored = 2 * axis.position - 1 - moved;
+            if (2 * axis.position < moved + 1 || mirrored >= limit) {
+                return std::nullopt;
+            }
+            moved = mirrored;
+            return std::pair{y, x};
+        }
+
+        std::size_t count_differences(const Grid& pattern, const Axis& axis) {
+            std::size_t differences = 0;
+            for (std::size_t y = 0; y != pattern.size(); y++) {
+                for (std::size_t x = 0; x != pattern[y].size(); x++) {
+                    if ((axis.vertical ? x : y) >= axis.position) {
+                        continue;
+                    }
+                    if (const auto partner = reflect(axis, y, x, pattern.size(), pattern[y].size())) {
+                        differences += pattern[y][x] != pattern[partner->first][partner->second] ? 1 : 0;
+                    }
+                }
+            }
+            return differences;
+        }
+
+        // A pattern with exactly one perfect mirror and exactly one mirror spoiled by a single smudge.
+        Grid make_pattern(Random& random) {
+            while (true) {
+                const auto rows = random.uniform<std::size_t>(5, 17);
+                const auto cols = random.uniform<std::size_t>(5, 17);
+                const auto random_axis = [&]() {
+                    const bool vertical = random.chance(0.5);
+                    return Axis{vertical, random.uniform<std::size_t>(1, (vertical ? cols : rows) - 1)};
+                };
+
+                const auto clean = random_axis();
+                const auto smudged = random_axis();
+                if (clean.vertical == smudged.vertical && clean.position == smudged.position) {
+                    continue;
+                }
+
+                // cells tied by either mirror must share a value
+                DisjointSet classes(rows * cols);
+                for (std::size_t y = 0; y != rows; y++) {
+                    for (std::size_t x = 0; x != cols; x++) {
+                        for (const auto& axis : {clean, smudged}) {
+                            if (const auto partner = reflect(axis, y, x, rows, cols)) {
+                                classes.unite(y * cols + x, partner->first * cols + partner->second);
+                            }
+                        }
+                    }
+                }
+
+                std::vector<char> values(rows * cols);
+                for (auto& value : values) {
+                    value = random.chance(0.5) ? '#' : '.';
+                }
+
+                Grid pattern(rows, std::string(cols, '.'));
+                std::vector<std::pair<std::size_t, std::size_t>> candidates;
+                for (std::size_t y = 0; y != rows; y++) {
+                    for (std::size_t x = 0; x != cols; x++) {
+                        pattern[y][x] = values[classes.find(y * cols + x)];
+                        if (!reflect(clean, y, x, rows, cols) && reflect(smudged, y, x, rows, cols)) {
+                            candidates.emplace_back(y, x);
+                        }
+                    }
+                }
+                if (candidates.empty()) {
+                    continue;
+                }
+
+                const auto [y, x] = random.pick(std::span<const std::pair<std::size_t, std::size_t>>(candidates));
+                pattern[y][x] = pattern[y][x] == '#' ? '.' : '#';
+
+                std::size_t perfect = 0;
+                std::size_t almost = 0;
+                for (const bool vertical : {true, false}) {
+                    for (std::size_t position = 1; position != (vertical ? cols : rows); position++) {
+                        const auto differences = count_differences(pattern, {vertical, position});
+                        perfect += differences == 0 ? 1 : 0;
+                        almost += differences == 1 ? 1 : 0;
+                    }
+                }
+                if (perfect == 1 && almost == 1) {
+                    return pattern;
+                }
+            }
+        }
+    }  // namespace
+
+
+    void gear_ratios(const Parameters& parameters, Random& random, Writer& out) {
+        static constexpr std::string_view Symbols = "*#+$/@%&=-";
+
+        std::string row(parameters.size, '.');
+        for (std::size_t y = 0; y != parameters.rows; y++) {
+            std::fill(row.begin(), row.end(), '.');
+            for (std::size_t x = 0; x < row.size();) {
+                if (random.chance(0.15)) {
+                    // a part number, always followed by a gap so it does not merge with the next one
+                    const auto digits = std::min(random.uniform<std::size_t>(1, 3), row.size() - x);
+                    row[x] = static_cast<char>('1' + random.uniform(0, 8));
+                    for (std::size_t i = 1; i != digits; i++) {
+                        row[x + i] = static_cast<char>('0' + random.uniform(0, 9));
+                    }
+                    x += digits + 1;
+                } else {
+                    if (random.chance(0.05)) {
+                        row[x] = random.chance(0.4) ? '*' : random.pick(Symbols);
+                    }
+                    x++;
+                }
+            }
+            out.line(row);
+        }
+    }
+
+    void pipe_maze(const Parameters& parameters, Random& random, Writer& out) {
+        // The loop runs along the top row and the left column, and snakes through every other row in between;
+        // the skipped rows give part two an interior. Everything off the loop is junk pipe.
+        static constexpr std::string_view Junk = "|-LJ7F..";
+
+        const auto rows = std::max<std::size_t>(parameters.rows, 4);
+        const auto cols = std::max<std::size_t>(parameters.size, 5);
+
+        std::vector<std::pair<std::size_t, std::size_t>> loop{{1, 1}};
+        const auto walk = [&loop](std::size_t y, std::size_t x) {
+            while (loop.back() != std::pair{y, x}) {
+                auto [cy, cx] = loop.back();
+                cy = cy < y ? cy + 1 : (cy > y ? cy - 1 : cy);
+                cx = cx < x ? cx + 1 : (cx > x ? cx - 1 : cx);
+                loop.emplace_back(cy, cx);
+            }
+        };
+
+        const std::size_t left = 1;
+        const auto right = cols - 2;
+        auto snakes = (rows - 2) / 2;
+        snakes -= snakes % 2 == 0 ? 1 : 0;
+
+        walk(1, right);
+        walk(2, right);
+        for (std::size_t i = 0; i != snakes; i++) {
+            const auto y = 2 + 2 * i;
+            walk(y, i % 2 == 0 ? left + 1 : right);
+            if (i + 1 != snakes) {
+                walk(y + 2, loop.back().second);
+            }
+        }
+        walk(loop.back().first, left);
+        walk(1, left);
+        loop.pop_back();
+
+        Grid grid(rows, std::string(cols, '.'));
+        for (auto& row : grid) {
+            for (auto& cell : row) {
+                cell = random.pick(Junk);
+            }
+        }
+
+        for (std::size_t i = 0; i != loop.size(); i++) {
+            const auto [y, x] = loop[i];
+            const auto& prev = loop[(i + loop.size() - 1) % loop.size()];
+            const auto& next = loop[(i + 1) % loop.size()];
+
+            const auto connects = [&](std::size_t dy, std::size_t dx) {
+                const std::pair cell{y + dy - 1, x + dx - 1};
+                return prev == cell || next == cell;
+            };
+            const bool north = connects(0, 1);
+            const bool south = connects(2, 1);
+            const bool west = connects(1, 0);
+            const bool east = connects(1, 2);
+
+            if (north && south) {
+                grid[y][x] = '|';
+            } else if (west && east) {
+                grid[y][x] = '-';
+            } else if (north) {
+                grid[y][x] = east ? 'L' : 'J';
+            } else {
+                grid[y][x] = east ? 'F' : '7';
+            }
+        }
+
+        const auto [start_y, start_x] = loop[random.uniform<std::size_t>(0, loop.size() - 1)];
+        grid[start_y][start_x] = 'S';
+        write_grid(grid, out);
+    }
+
+    void cosmic_expansion(const Parameters& parameters, Random& random, Writer& out) {
+        std::vector<bool> empty_columns(parameters.size);
+        for (std::size_t x = 0; x != parameters.size; x++) {
+            empty_columns[x] = random.chance(0.1);
+        }
+
+        std::string row(parameters.size, '.');
+        for (std::size_t y = 0; y != parameters.rows; y++) {
+            const bool empty_row = random.chance(0.1);
+            for (std::size_t x = 0; x != row.size(); x++) {
+                row[x] = !empty_row && !empty_columns[x] && random.chance(0.03) ? '#' : '.';
+            }
+            out.line(row);
+        }
+    }
+
+    void point_of_incidence(const Parameters& parameters, Random& random, Writer& out) {
+        for (std::size_t i = 0; i != parameters.size; i++) {
+            if (i != 0) {
+                out.line();
+            }
+            write_grid(make_pattern(random), out);
+        }
+    }
+
+    void parabolic_reflector_dish(const Parameters& parameters, Random& random, Writer& out) {
+        write_cells(parameters, out, [&random](std::size_t, std::size_t) {
+            const auto roll = random.uniform(0, 99);
+            return roll < 20 ? 'O' : (roll < 35 ? '#' : '.');
+        });
+    }
+
+    void lava_floor(const Parameters& parameters, Random& random, Writer& out) {
+        static constexpr std::string_view Optics = "/\\|-";
+
+        write_cells(parameters, out, [&random](std::size_t, std::size_t) {
+            return random.chance(0.1) ? random.pick(Optics) : '.';
+        });
+    }
+
+    void clumsy_crucible(const Parameters& parameters, Random& random, Writer& out) {
+        write_cells(parameters, out, [&random](std::size_t, std::size_t) {
+            return static_cast<char>('1' + random.uniform(0, 8));
+        });
+    }
+
+    void step_counter(const Parameters& parameters, Random& random, Writer& out) {
+        // like the real input: odd square, start in the middle, clear border and clear middle cross
+        const auto side = make_odd(parameters.size, 5);
+        const auto middle = side / 2;
+
+        std::string row(side, '.');
+        for (std::size_t y = 0; y != side; y++) {
+            for (std::size_t x = 0; x != side; x++) {
+                const bool clear = y == 0 || x == 0 || y + 1 == side || x + 1 == side || y == middle || x == middle;
+                row[x] = !clear && random.chance(0.12) ? '#' : '.';
+            }
+            if (y == middle) {
+                row[middle] = 'S';
+            }
+            out.line(row);
+        }
+    }
+
+    void long_walk(const Parameters& parameters, Random& random, Writer& out) {
+        // Trails connect the odd lattice points: a random spanning tree, a staircase that guarantees a way from
+        // the top left to the bottom right, and a few extra trails for cycles. Slopes only ever point right or
+        // down and sit at junction entries, so the staircase stays walkable in part one.
+        const auto rows = make_odd(parameters.rows, 5);
+        const auto cols = make_odd(parameters.size, 5);
+        const auto lattice_rows = rows / 2;
+        const auto lattice_cols = cols / 2;
+
+        Grid grid(rows, std::string(cols, '#'));
+        const auto open = [&grid](std::size_t y, std::size_t x) { grid[y][x] = '.'; };
+        const auto connect = [&](std::size_t from, std::size_t to) {
+            const auto y1 = 2 * (from / lattice_cols) + 1;
+            const auto x1 = 2 * (from % lattice_cols) + 1;
+            const auto y2 = 2 * (to / lattice_cols) + 1;
+            const auto x2 = 2 * (to % lattice_cols) + 1;
+            open(y1, x1);
+            open((y1 + y2) / 2, (x1 + x2) / 2);
+            open(y2, x2);
+        };
+        const auto neighbours = [&](std::size_t node) {
+            std::vector<std::size_t> result;
+            const auto y = node / lattice_cols;
+            const auto x = node % lattice_cols;
+            if (y != 0) {
+                result.push_back(node - lattice_cols);
+            }
+            if (y + 1 != lattice_rows) {
+                result.push_back(node + lattice_cols);
+            }
+            if (x != 0) {
+                result.push_back(node - 1);
+            }
+            if (x + 1 != lattice_cols) {
+                result.push_back(node + 1);
+            }
+            return result;
+        };
+
+        std::vector<bool> visited(lattice_rows * lattice_cols);
+        std::vector<std::size_t> stack{0};
+        visited[0] = true;
+        open(1, 1);
+        while (!stack.empty()) {
+            auto candidates = neighbours(stack.back());
+            std::erase_if(candidates, [&visited](std::size_t node) { return visited[node]; });
+            if (candidates.empty()) {
+                stack.pop_back();
+                continue;
+            }
+
+            const auto next = random.pick(std::span<const std::size_t>(candidates));
+            connect(stack.back(), next);
+            visited[next] = true;
+            stack.push_back(next);
+        }
+
+        for (std::size_t node = 0; node + 1 != lattice_rows * lattice_cols;) {
+            const auto y = node / lattice_cols;
+            const auto x = node % lattice_cols;
+            const bool down = x + 1 == lattice_cols || (y + 1 != lattice_rows && random.chance(0.5));
+            const auto next = down ? node + lattice_cols : node + 1;
+            connect(node, next);
+            node = next;
+        }
+
+        for (std::size_t node = 0; node != lattice_rows * lattice_cols; node++) {
+            for (const auto next : neighbours(node)) {
+                if (next > node && random.chance(0.05)) {
+                    connect(node, next);
+                }
+            }
+        }
+
+        const auto is_junction = [&](std::size_t y, std::size_t x) {
+            std::size_t exits = 0;
+            exits += grid[y - 1][x] != '#' ? 1 : 0;
+            exits += grid[y + 1][x] != '#' ? 1 : 0;
+            exits += grid[y][x - 1] != '#' ? 1 : 0;
+            exits += grid[y][x + 1] != '#' ? 1 : 0;
+            return exits >= 3;
+        };
+        using Entry = std::tuple<std::size_t, std::size_t, char>;
+        for (std::size_t y = 1; y < rows; y += 2) {
+            for (std::size_t x = 1; x < cols; x += 2) {
+                if (!is_junction(y, x)) {
+                    continue;
+                }
+                const std::array<Entry, 4> entries{
+                    Entry{y, x + 1, '>'},
+                    Entry{y, x - 1, '>'},
+                    Entry{y + 1, x, 'v'},
+                    Entry{y - 1, x, 'v'},
+                };
+                for (const auto& [ny, nx, slope] : entries) {
+                    if (grid[ny][nx] == '.' && ny != 0 && ny + 1 != rows) {
+                        grid[ny][nx] = slope;
+                    }
+                }
+            }
+        }
+
+        open(0, 1);
+        open(rows - 1, cols - 2);
+        write_grid(grid, out);
+    }
+}  // namespace generator
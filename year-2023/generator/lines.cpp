@@ -0,0 +1,656 @@
+#include "generator.hpp"
+
+#include <array>
+#include <cstdlib>
+#include <cstdint>
+#include <numeric>
+#include <set>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+
+namespace generator {
+    namespace {
+        constexpr std::string_view Letters = "abcdefghijklmnopqrstuvwxyz";
+
+        std::string encode(std::size_t value, std::string_view alphabet, std::size_t width) {
+            std::string text(width, alphabet.front());
+            for (auto i = width; i-- != 0 && value != 0;) {
+                text[i] = alphabet[value % alphabet.size()];
+                value /= alphabet.size();
+            }
+            return text;
+        }
+
+        std::size_t digits_needed(std::size_t count, std::size_t base, std::size_t min_width) {
+            std::size_t width = 1;
+            for (std::size_t capacity = base; capacity < count; capacity *= base) {
+                width++;
+            }
+            return std::max(width, min_width);
+        }
+
+        // Distinct values drawn from [low, high]; `count` must not exceed the range size.
+        std::vector<std::uint32_t> distinct(Random& random, std::size_t count, std::uint32_t low, std::uint32_t high) {
+            std::unordered_set<std::uint32_t> taken;
+            std::vector<std::uint32_t> values;
+            while (values.size() != count) {
+                const auto value = random.uniform(low, high);
+                if (taken.insert(value).second) {
+                    values.push_back(value);
+                }
+            }
+            return values;
+        }
+    }  // namespace
+
+
+    std::vector<std::string> make_names(Random& random, std::size_t count, std::size_t min_length) {
+        const auto width = digits_needed(count, Letters.size(), min_length);
+        std::unordered_set<std::string> taken;
+
+        std::vector<std::string> names;
+        names.reserve(count);
+        while (names.size() != count) {
+            std::string name(width, ' ');
+            for (auto& symbol : name) {
+                symbol = random.pick(Letters);
+            }
+            if (taken.insert(name).second) {
+                names.emplace_back(std::move(name));
+            }
+        }
+        return names;
+    }
+
+
+    void trebuchet(const Parameters& parameters, Random& random, Writer& out) {
+        static constexpr std::array<std::string_view, 9> Words{
+            "one", "two", "three", "four", "five", "six", "seven", "eight", "nine",
+        };
+
+        for (std::size_t i = 0; i != parameters.size; i++) {
+            const auto tokens = random.uniform(1, 6);
+            bool has_digit = false;
+            for (int token = 0; token != tokens; token++) {
+                const auto kind = random.uniform(0, 2);
+                if (kind == 0) {
+                    for (auto letters = random.uniform(1, 8); letters != 0; letters--) {
+                        out.put(random.pick(Letters));
+                    }
+                } else if (kind == 1) {
+                    out.put(static_cast<char>('1' + random.uniform(0, 8)));
+                    has_digit = true;
+                } else {
+                    out.text(random.pick(std::span<const std::string_view>(Words)));
+                    has_digit = true;
+                }
+            }
+
+            if (!has_digit) {
+                out.put(static_cast<char>('1' + random.uniform(0, 8)));
+            }
+            out.line();
+        }
+    }
+
+    void cube_conundrum(const Parameters& parameters, Random& random, Writer& out) {
+        static constexpr std::array<std::string_view, 3> Colors{"red", "green", "blue"};
+
+        for (std::size_t id = 1; id <= parameters.size; id++) {
+            out.text("Game ").number(id).text(": ");
+
+            const auto sets = random.uniform(1, 6);
+            for (int set = 0; set != sets; set++) {
+                auto colors = Colors;
+                random.shuffle(colors);
+
+                const auto count = random.uniform(1, 3);
+                for (int color = 0; color != count; color++) {
+                    out.number(random.uniform(1, 20)).put(' ').text(colors[color]);
+                    if (color + 1 != count) {
+                        out.text(", ");
+                    }
+                }
+                if (set + 1 != sets) {
+                    out.text("; ");
+                }
+            }
+            out.line();
+        }
+    }
+
+    void scratchcards(const Parameters& parameters, Random& random, Writer& out) {
+        static constexpr std::size_t WinningCount = 10;
+        static constexpr std::size_t DraftCount = 25;
+
+        for (std::size_t id = 1; id <= parameters.size; id++) {
+            // most cards win a little; a card never copies cards past the end of the table
+            auto matches = random.chance(0.5) ? random.uniform<std::size_t>(0, 4) : 0;
+            if (random.chance(0.05)) {
+                matches = random.uniform<std::size_t>(5, WinningCount);
+            }
+            matches = std::min(matches, parameters.size - id);
+
+            auto numbers = distinct(random, WinningCount + DraftCount - matches, 1, 99);
+            const std::vector<std::uint32_t> winning(numbers.begin(), numbers.begin() + WinningCount);
+            std::vector<std::uint32_t> draft(numbers.begin() + WinningCount, numbers.end());
+            draft.insert(draft.end(), winning.begin(), winning.begin() + static_cast<std::ptrdiff_t>(matches));
+            random.shuffle(draft);
+
+            out.text("Card ").number(id, 3).put(':');
+            for (const auto number : winning) {
+                out.put(' ').number(number, 2);
+            }
+            out.text(" |");
+            for (const auto number : draft) {
+                out.put(' ').number(number, 2);
+            }
+            out.line();
+        }
+    }
+
+    void garden_calculator(const Parameters& parameters, Random& random, Writer& out) {
+        static constexpr std::array<std::string_view, 7> Maps{
+            "seed-to-soil",         "soil-to-fertilizer",      "fertilizer-to-water",  "water-to-light",
+            "light-to-temperature", "temperature-to-humidity", "humidity-to-location",
+        };
+        static constexpr std::uint64_t Universe = std::uint64_t{1} << 32;
+
+        // the solver walks every seed, so ranges stay short and their number is what scales
+        out.text("seeds:");
+        for (std::size_t i = 0; i != parameters.size; i++) {
+            out.put(' ').number(random.uniform<std::uint64_t>(0, Universe - 101)).put(' ');
+            out.number(random.uniform<std::uint64_t>(1, 100));
+        }
+        out.line();
+
+        for (const auto name : Maps) {
+            out.line();
+            out.text(name).line(" map:");
+
+            const auto entries = random.uniform<std::size_t>(10, 40);
+            std::set<std::uint64_t> cuts{0, Universe};
+            while (cuts.size() != entries + 1) {
+                cuts.insert(random.uniform<std::uint64_t>(1, Universe - 1));
+            }
+
+            std::vector<std::pair<std::uint64_t, std::uint64_t>> ranges;
+            for (auto it = cuts.cbegin(); std::next(it) != cuts.cend(); ++it) {
+                if (random.chance(0.8)) {
+                    ranges.emplace_back(*it, *std::next(it) - *it);
+                }
+            }
+            random.shuffle(ranges);
+
+            for (const auto& [source, length] : ranges) {
+                const auto destination = random.uniform<std::uint64_t>(0, Universe - length);
+                out.number(destination).put(' ').number(source).put(' ').number(length).line();
+            }
+        }
+    }
+
+    void wait_for_it(const Parameters& parameters, Random& random, Writer& out) {
+        // two-digit times with three-digit records keep the glued part two race winnable too
+        std::vector<std::uint32_t> times;
+        std::vector<std::uint32_t> records;
+        for (std::size_t i = 0; i != parameters.size; i++) {
+            const auto time = random.uniform<std::uint32_t>(21, 99);
+            times.push_back(time);
+            records.push_back(random.uniform<std::uint32_t>(100, std::min<std::uint32_t>(time * time / 4 - 1, 999)));
+        }
+
+        out.text("Time:    ");
+        for (const auto time : times) {
+            out.number(time, 7);
+        }
+        out.line();
+
+        out.text("Distance:");
+        for (const auto record : records) {
+            out.number(record, 7);
+        }
+        out.line();
+    }
+
+    void camel_cards(const Parameters& parameters, Random& random, Writer& out) {
+        static constexpr std::string_view Cards = "23456789TJQKA";
+
+        for (std::size_t i = 0; i != parameters.size; i++) {
+            for (int card = 0; card != 5; card++) {
+                out.put(random.pick(Cards));
+            }
+            out.put(' ').number(random.uniform(1, 1000)).line();
+        }
+    }
+
+    void haunted_wasteland(const Parameters& parameters, Random& random, Writer& out) {
+        // Every ghost walks its own chain of layers; each layer has a left and a right node and both lead to the
+        // next layer, so whatever the route says a ghost reaches its Z node after exactly `length` steps and then
+        // loops. Ghost 0 starts at AAA and ends at ZZZ, which keeps part one valid as well.
+        static constexpr std::size_t Ghosts = 6;
+        static constexpr std::string_view Alphabet = "0123456789BCDEFGHIJKLMNOPQRSTUVWXY";  // no A and Z
+
+        const auto longest = std::max<std::size_t>(2, parameters.size / (2 * Ghosts));
+        const auto width = digits_needed(Ghosts * 2 * longest, Alphabet.size(), 3);
+
+        std::size_t counter = 0;
+        const auto next_name = [&]() { return encode(counter++, Alphabet, width); };
+
+        out.text([&random]() {
+            std::string route(random.uniform<std::size_t>(250, 310), 'L');
+            for (auto& direction : route) {
+                direction = random.chance(0.5) ? 'L' : 'R';
+            }
+            return route;
+        }());
+        out.line().line();
+
+        std::vector<std::tuple<std::string, std::string, std::string>> nodes;
+        for (std::size_t ghost = 0; ghost != Ghosts; ghost++) {
+            const auto start = ghost == 0 ? std::string(width, 'A') : encode(ghost, Alphabet, width - 1) + 'A';
+            const auto finish = ghost == 0 ? std::string(width, 'Z') : encode(ghost, Alphabet, width - 1) + 'Z';
+            const auto length = random.uniform(std::max<std::size_t>(2, longest / 2), longest);
+
+            std::vector<std::pair<std::string, std::string>> layers;
+            for (std::size_t layer = 1; layer != length; layer++) {
+                layers.emplace_back(next_name(), next_name());
+            }
+
+            nodes.emplace_back(start, layers.front().first, layers.front().second);
+            for (std::size_t layer = 0; layer != layers.size(); layer++) {
+                const bool last = layer + 1 == layers.size();
+                const auto left = last ? finish : layers[layer + 1].first;
+                const auto right = last ? finish : layers[layer + 1].second;
+                nodes.emplace_back(layers[layer].first, left, right);
+                nodes.emplace_back(layers[layer].second, left, right);
+            }
+            nodes.emplace_back(finish, layers.front().first, layers.front().second);
+        }
+        random.shuffle(nodes);
+
+        for (const auto& [name, left, right] : nodes) {
+            out.text(name).text(" = (").text(left).text(", ").text(right).line(")");
+        }
+    }
+
+    void mirage_maintenance(const Parameters& parameters, Random& random, Writer& out) {
+        static constexpr std::size_t Values = 21;
+
+        for (std::size_t i = 0; i != parameters.size; i++) {
+            // integrate a constant difference row `degree` times: the history is always a polynomial sequence
+            const auto degree = random.uniform(1, 6);
+            std::vector<std::int64_t> row(Values, random.uniform<std::int64_t>(-5, 5));
+            for (int level = 0; level != degree; level++) {
+                std::vector<std::int64_t> integrated{random.uniform<std::int64_t>(-20, 20)};
+                for (std::size_t x = 1; x != Values; x++) {
+                    integrated.push_back(integrated.back() + row[x - 1]);
+                }
+                row = std::move(integrated);
+            }
+
+            for (std::size_t x = 0; x != Values; x++) {
+                out.number(row[x]);
+                if (x + 1 != Values) {
+                    out.put(' ');
+                }
+            }
+            out.line();
+        }
+    }
+
+    void hot_springs(const Parameters& parameters, Random& random, Writer& out) {
+        for (std::size_t i = 0; i != parameters.size; i++) {
+            // draw a concrete row first, so the groups always have at least one arrangement
+            std::string springs(random.uniform<std::size_t>(5, 20), '.');
+            for (auto& spring : springs) {
+                spring = random.chance(0.45) ? '#' : '.';
+            }
+            springs[random.uniform<std::size_t>(0, springs.size() - 1)] = '#';
+
+            std::vector<std::size_t> groups;
+            for (std::size_t pos = 0; pos != springs.size();) {
+                if (springs[pos] != '#') {
+                    pos++;
+                    continue;
+                }
+                const auto end = std::min(springs.find('.', pos), springs.size());
+                groups.push_back(end - pos);
+                pos = end;
+            }
+
+            for (auto& spring : springs) {
+                if (random.chance(0.5)) {
+                    spring = '?';
+                }
+            }
+
+            out.text(springs).put(' ');
+            for (std::size_t group = 0; group != groups.size(); group++) {
+                out.number(groups[group]);
+                if (group + 1 != groups.size()) {
+                    out.put(',');
+                }
+            }
+            out.line();
+        }
+    }
+
+    void lens_library(const Parameters& parameters, Random& random, Writer& out) {
+        auto labels = make_names(random, std::max<std::size_t>(10, parameters.size / 4), 2);
+        for (auto& label : labels) {
+            for (auto extra = random.uniform(0, 4); extra != 0; extra--) {
+                label.push_back(random.pick(Letters));
+            }
+        }
+
+        for (std::size_t i = 0; i != parameters.size; i++) {
+            if (i != 0) {
+                out.put(',');
+            }
+
+            out.text(random.pick(std::span<const std::string>(labels)));
+            if (random.chance(0.3)) {
+                out.put('-');
+            } else {
+                out.put('=').number(random.uniform(1, 9));
+            }
+        }
+        out.line();
+    }
+
+    void lavaduct_lagoon(const Parameters& parameters, Random& random, Writer& out) {
+        // The trench follows a top profile to the right and a bottom profile back to the left; the top stays above
+        // zero and the bottom below it, so the loop never crosses itself. Part two's colours encode a second,
+        // independent loop of the same shape with far larger distances.
+        const auto segments = std::max<std::size_t>(1, parameters.size / 4);
+
+        const auto make_loop = [&random, segments](std::int64_t max_width, std::int64_t max_height) {
+            const auto profile = [&](std::int64_t sign) {
+                std::vector<std::int64_t> heights;
+                while (heights.size() != segments) {
+                    const auto height = sign * random.uniform<std::int64_t>(1, max_height);
+                    if (heights.empty() || heights.back() != height) {
+                        heights.push_back(height);
+                    }
+                }
+                return heights;
+            };
+
+            std::vector<std::int64_t> top_widths(segments);
+            for (auto& width : top_widths) {
+                width = random.uniform<std::int64_t>(1, max_width);
+            }
+            const auto total = std::accumulate(top_widths.cbegin(), top_widths.cend(), std::int64_t{0});
+
+            // split the same total width into the bottom segments
+            std::set<std::int64_t> cuts{0, total};
+            while (cuts.size() < std::min<std::size_t>(segments, static_cast<std::size_t>(total)) + 1) {
+                cuts.insert(random.uniform<std::int64_t>(1, total - 1));
+            }
+            std::vector<std::int64_t> bottom_widths;
+            for (auto it = cuts.cbegin(); std::next(it) != cuts.cend(); ++it) {
+                bottom_widths.push_back(*std::next(it) - *it);
+            }
+
+            const auto top = profile(1);
+            auto bottom = profile(-1);
+            bottom.resize(bottom_widths.size());
+
+            std::vector<std::pair<char, std::int64_t>> moves;
+            for (std::size_t i = 0; i != top.size(); i++) {
+                if (i != 0) {
+                    moves.emplace_back(top[i] > top[i - 1] ? 'U' : 'D', std::abs(top[i] - top[i - 1]));
+                }
+                moves.emplace_back('R', top_widths[i]);
+            }
+            moves.emplace_back('D', top.back() - bottom.back());
+            for (auto i = bottom.size(); i-- != 0;) {
+                moves.emplace_back('L', bottom_widths[i]);
+                if (i != 0) {
+                    moves.emplace_back(bottom[i - 1] > bottom[i] ? 'U' : 'D', std::abs(bottom[i - 1] - bottom[i]));
+                }
+            }
+            moves.emplace_back('U', top.front() - bottom.front());
+            return moves;
+        };
+
+        const auto plan = make_loop(10, 10);
+        auto colors = make_loop(0xFFFFF / static_cast<std::int64_t>(segments + 1), 0x7FFFF);
+        while (colors.size() != plan.size()) {
+            colors = make_loop(0xFFFFF / static_cast<std::int64_t>(segments + 1), 0x7FFFF);
+        }
+
+        static constexpr std::string_view HexDigits = "0123456789abcdef";
+        static constexpr std::string_view Directions = "RDLU";
+        for (std::size_t i = 0; i != plan.size(); i++) {
+            out.put(plan[i].first).put(' ').number(plan[i].second).text(" (#");
+            for (int shift = 16; shift >= 0; shift -= 4) {
+                out.put(HexDigits[(colors[i].second >> shift) & 0xF]);
+            }
+            out.put(static_cast<char>('0' + Directions.find(colors[i].first))).line(")");
+        }
+    }
+
+    void aplenty(const Parameters& parameters, Random& random, Writer& out) {
+        static constexpr std::string_view Categories = "xmas";
+
+        // workflows form a tree rooted at "in", so every part ends in A or R
+        const auto count = std::max<std::size_t>(1, parameters.size);
+        auto names = make_names(random, count + 1, 2);
+        names.erase(std::remove(names.begin(), names.end(), "in"), names.end());
+        names.resize(count);
+        names.front() = "in";
+
+        std::size_t defined = 1;
+        const auto target = [&]() -> std::string {
+            if (defined != count && random.chance(0.6)) {
+                return names[defined++];
+            }
+            return random.chance(0.5) ? "A" : "R";
+        };
+
+        for (std::size_t i = 0; i != count; i++) {
+            out.text(names[i]).put('{');
+            for (auto rules = random.uniform(1, 3); rules != 0; rules--) {
+                out.put(random.pick(Categories)).put(random.chance(0.5) ? '<' : '>');
+                out.number(random.uniform(1, 4000)).put(':').text(target()).put(',');
+            }
+            out.text(target()).line("}");
+        }
+        out.line();
+
+        for (std::size_t i = 0; i != parameters.size; i++) {
+            out.text("{x=").number(random.uniform(1, 4000)).text(",m=").number(random.uniform(1, 4000));
+            out.text(",a=").number(random.uniform(1, 4000)).text(",s=").number(random.uniform(1, 4000)).line("}");
+        }
+    }
+
+    void pulse_propagation(const Parameters& parameters, Random& random, Writer& out) {
+        // Each chain is a 12-bit counter: flip-flops whose bit is set report to the chain's conjunction, which
+        // resets the others (and kicks the first one). A chain fires after N presses, N being its bit pattern, and
+        // all chains feed `rx` through inverters and one final conjunction.
+        static constexpr std::size_t Bits = 12;
+
+        const auto chains = std::max<std::size_t>(1, parameters.size);
+        const auto names = make_names(random, chains * (Bits + 2) + 1, 2);
+        const auto& final_name = names.back();
+
+        std::vector<std::string> lines;
+        std::string broadcaster = "broadcaster -> ";
+        for (std::size_t chain = 0; chain != chains; chain++) {
+            const auto* base = &names[chain * (Bits + 2)];
+            const auto& hub = base[Bits];
+            const auto& inverter = base[Bits + 1];
+
+            // odd and with the top bit set, so both the first and the last flip-flop feed the hub
+            const auto period = random.uniform<std::uint32_t>(1U << (Bits - 1), (1U << Bits) - 1) | 1U;
+
+            std::string hub_line = "&" + hub + " -> " + inverter + ", " + base[0];
+            for (std::size_t bit = 0; bit != Bits; bit++) {
+                const bool set = ((period >> bit) & 1U) != 0;
+
+                std::string line = "%" + base[bit] + " -> ";
+                if (bit + 1 != Bits) {
+                    line += base[bit + 1];
+                    if (set) {
+                        line += ", " + hub;
+                    }
+                } else {
+                    line += hub;
+                }
+                lines.emplace_back(std::move(line));
+
+                if (!set) {
+                    hub_line += ", " + base[bit];
+                }
+            }
+            lines.emplace_back(std::move(hub_line));
+            lines.emplace_back("&" + inverter + " -> " + final_name);
+
+            broadcaster += (chain != 0 ? ", " : "") + base[0];
+        }
+        lines.emplace_back(std::move(broadcaster));
+        lines.emplace_back("&" + final_name + " -> rx");
+        random.shuffle(lines);
+
+        for (const auto& line : lines) {
+            out.line(line);
+        }
+    }
+
+    void sand_slabs(const Parameters& parameters, Random& random, Writer& out) {
+        static constexpr std::int32_t Footprint = 10;
+
+        const auto max_z = static_cast<std::int32_t>(parameters.size / 10 + 10);
+        std::unordered_set<std::uint64_t> occupied;
+        const auto key = [](std::int32_t x, std::int32_t y, std::int32_t z) {
+            return (static_cast<std::uint64_t>(z) << 16) | static_cast<std::uint64_t>(y * Footprint + x);
+        };
+
+        for (std::size_t placed = 0; placed != parameters.size;) {
+            std::array<std::int32_t, 3> from{
+                random.uniform<std::int32_t>(0, Footprint - 1),
+                random.uniform<std::int32_t>(0, Footprint - 1),
+                random.uniform<std::int32_t>(1, max_z),
+            };
+            auto to = from;
+            const auto axis = random.uniform<std::size_t>(0, 2);
+            to[axis] += random.uniform<std::int32_t>(0, 4);
+            if (to[0] >= Footprint || to[1] >= Footprint) {
+                continue;
+            }
+
+            std::vector<std::uint64_t> cells;
+            for (auto x = from[0]; x <= to[0]; x++) {
+                for (auto y = from[1]; y <= to[1]; y++) {
+                    for (auto z = from[2]; z <= to[2]; z++) {
+                        cells.push_back(key(x, y, z));
+                    }
+                }
+            }
+            if (std::any_of(cells.cbegin(), cells.cend(), [&occupied](auto cell) { return occupied.contains(cell); })) {
+                continue;
+            }
+            occupied.insert(cells.cbegin(), cells.cend());
+
+            out.number(from[0]).put(',').number(from[1]).put(',').number(from[2]).put('~');
+            out.number(to[0]).put(',').number(to[1]).put(',').number(to[2]).line();
+            placed++;
+        }
+    }
+
+    void never_tell_me_the_odds(const Parameters& parameters, Random& random, Writer& out) {
+        // every hailstone is on the path of one hidden rock throw, so part two has its answer
+        const std::array<std::int64_t, 3> rock{
+            random.uniform<std::int64_t>(100'000'000'000'000, 300'000'000'000'000),
+            random.uniform<std::int64_t>(100'000'000'000'000, 300'000'000'000'000),
+            random.uniform<std::int64_t>(100'000'000'000'000, 300'000'000'000'000),
+        };
+        const std::array<std::int64_t, 3> throw_velocity{
+            random.uniform<std::int64_t>(-300, 300),
+            random.uniform<std::int64_t>(-300, 300),
+            random.uniform<std::int64_t>(-300, 300),
+        };
+
+        std::unordered_set<std::int64_t> times;
+        for (std::size_t i = 0; i != parameters.size; i++) {
+            auto time = random.uniform<std::int64_t>(100'000'000'000, 1'000'000'000'000);
+            while (!times.insert(time).second) {
+                time = random.uniform<std::int64_t>(100'000'000'000, 1'000'000'000'000);
+            }
+
+            std::array<std::int64_t, 3> velocity{};
+            std::array<std::int64_t, 3> position{};
+            for (std::size_t axis = 0; axis != 3; axis++) {
+                velocity[axis] = random.uniform<std::int64_t>(-500, 500);
+                position[axis] = rock[axis] + (throw_velocity[axis] - velocity[axis]) * time;
+            }
+
+            out.number(position[0]).text(", ").number(position[1]).text(", ").number(position[2]).text(" @ ");
+            out.number(velocity[0]).text(", ").number(velocity[1]).text(", ").number(velocity[2]).line();
+        }
+    }
+
+    void snowverload(const Parameters& parameters, Random& random, Writer& out) {
+        // two dense halves joined by exactly three wires
+        const auto count = std::max<std::size_t>(parameters.size, 10);
+        const auto names = make_names(random, count, 3);
+        const auto half = count / 2;
+
+        std::set<std::pair<std::size_t, std::size_t>> edges;
+        const auto connect = [&edges](std::size_t lhs, std::size_t rhs) {
+            if (lhs != rhs) {
+                edges.emplace(std::min(lhs, rhs), std::max(lhs, rhs));
+            }
+        };
+
+        for (std::size_t node = 0; node != count; node++) {
+            const auto low = node < half ? 0 : half;
+            const auto high = node < half ? half - 1 : count - 1;
+            for (int link = 0; link != 4; link++) {
+                connect(node, random.uniform(low, high));
+            }
+        }
+
+        std::set<std::pair<std::size_t, std::size_t>> bridges;
+        while (bridges.size() != 3) {
+            const auto lhs = random.uniform<std::size_t>(0, half - 1);
+            const auto rhs = random.uniform<std::size_t>(half, count - 1);
+            if (std::none_of(bridges.cbegin(), bridges.cend(), [&](const auto& bridge) {
+                    return bridge.first == lhs || bridge.second == rhs;
+                })) {
+                bridges.emplace(lhs, rhs);
+            }
+        }
+        edges.insert(bridges.cbegin(), bridges.cend());
+
+        std::vector<std::vector<std::size_t>> adjacency(count);
+        for (const auto& [lhs, rhs] : edges) {
+            if (random.chance(0.5)) {
+                adjacency[lhs].push_back(rhs);
+            } else {
+                adjacency[rhs].push_back(lhs);
+            }
+        }
+
+        std::vector<std::size_t> order(count);
+        std::iota(order.begin(), order.end(), 0);
+        random.shuffle(order);
+        for (const auto node : order) {
+            if (adjacency[node].empty()) {
+                continue;
+            }
+
+            out.text(names[node]).put(':');
+            for (const auto neighbour : adjacency[node]) {
+                out.put(' ').text(names[neighbour]);
+            }
+            out.line();
+        }
+    }
+}  // namespace generator
@@ -0,0 +1,180 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <common/io.hpp>
+
+#include "generator.hpp"
+
+
+namespace {
+    struct Generator {
+        unsigned day = 0;
+        std::string_view name;
+        generator::Generate generate = nullptr;
+        std::size_t size = 0;  // defaults are close to the shape of the real puzzle input
+        std::size_t rows = 0;
+    };
+
+    // clang-format off
+    constexpr std::array<Generator, 25> Generators{{
+        { 1, "trebuchet",                generator::trebuchet,                1000,    0},
+        { 2, "cube-conundrum",           generator::cube_conundrum,            100,    0},
+        { 3, "gear-ratios",              generator::gear_ratios,               140,  140},
+        { 4, "scratchcards",             generator::scratchcards,              200,    0},
+        { 5, "garden-calculator",        generator::garden_calculator,          10,    0},
+        { 6, "wait-for-it",              generator::wait_for_it,                 4,    0},
+        { 7, "camel-cards",              generator::camel_cards,              1000,    0},
+        { 8, "haunted-wasteland",        generator::haunted_wasteland,         750,    0},
+        { 9, "mirage-maintenance",       generator::mirage_maintenance,        200,    0},
+        {10, "pipe-maze",                generator::pipe_maze,                 140,  140},
+        {11, "cosmic-expansion",         generator::cosmic_expansion,          140,  140},
+        {12, "hot-springs",              generator::hot_springs,              1000,    0},
+        {13, "point-of-incidence",       generator::point_of_incidence,        100,    0},
+        {14, "parabolic-reflector-dish", generator::parabolic_reflector_dish,  100,  100},
+        {15, "lens-library",             generator::lens_library,             4000,    0},
+        {16, "lava-floor",               generator::lava_floor,                110,  110},
+        {17, "clumsy-crucible",          generator::clumsy_crucible,           141,  141},
+        {18, "lavaduct-lagoon",          generator::lavaduct_lagoon,           700,    0},
+        {19, "aplenty",                  generator::aplenty,                   550,    0},
+        {20, "pulse-propagation",        generator::pulse_propagation,           4,    0},
+        {21, "step-counter",             generator::step_counter,              131,    0},
+        {22, "sand-slabs",               generator::sand_slabs,               1200,    0},
+        {23, "long-walk",                generator::long_walk,                 141,  141},
+        {24, "never-tell-me-the-odds",   generator::never_tell_me_the_odds,    300,    0},
+        {25, "snowverload",              generator::snowverload,              1500,    0},
+    }};
+    // clang-format on
+
+    struct Options {
+        const Generator* generator = nullptr;
+        generator::Parameters parameters;
+        std::optional<std::filesystem::path> output;
+        bool list = false;
+    };
+
+    void print_usage(std::string_view program) {
+        std::cerr << "usage: " << program << " <day> [--size <count>] [--rows <count>] [--seed <value>]"
+                  << " [--output <file>]\n"
+                  << "       " << program << " --list\n"
+                  << "  --size    the day's scale: lines, records, nodes or grid columns (default: real input size)\n"
+                  << "  --rows    grid height for grid puzzles (default: real input size)\n"
+                  << "  --seed    random seed, equal seeds give equal inputs (default: 2023)\n"
+                  << "  --output  file to write (default: standard output)\n"
+                  << "  --list    print every day with its defaults" << std::endl;
+    }
+
+    void print_list() {
+        for (const auto& generator : Generators) {
+            std::cout << generator.day << '\t' << generator.name << "\tsize " << generator.size;
+            if (generator.rows != 0) {
+                std::cout << "\trows " << generator.rows;
+            }
+            std::cout << '\n';
+        }
+    }
+
+    Options parse_options(int argc, char** argv) {
+        Options options;
+        options.parameters.seed = 2023;
+
+        std::optional<std::size_t> size;
+        std::optional<std::size_t> rows;
+
+        const std::vector<std::string_view> args(argv + 1, argv + argc);
+        for (std::size_t i = 0; i != args.size(); i++) {
+            const auto arg = args[i];
+            if (arg == "--list") {
+                options.list = true;
+            } else if (arg == "--size" && i + 1 != args.size()) {
+                auto value = args[++i];
+                size = io::read<std::size_t>(value);
+            } else if (arg == "--rows" && i + 1 != args.size()) {
+                auto value = args[++i];
+                rows = io::read<std::size_t>(value);
+            } else if (arg == "--seed" && i + 1 != args.size()) {
+                auto value = args[++i];
+                options.parameters.seed = io::read<std::uint64_t>(value);
+            } else if (arg == "--output" && i + 1 != args.size()) {
+                options.output = args[++i];
+            } else if (options.generator == nullptr) {
+                auto value = arg;
+                const auto day = io::read<unsigned>(value);
+                if (day == 0 || day > Generators.size()) {
+                    throw std::invalid_argument("unknown day '" + std::string(arg) + "'");
+                }
+                options.generator = &Generators[day - 1];
+            } else {
+                throw std::invalid_argument("unexpected argument '" + std::string(arg) + "'");
+            }
+        }
+
+        if (options.list) {
+            return options;
+        }
+        if (options.generator == nullptr) {
+            throw std::invalid_argument("no day given");
+        }
+
+        options.parameters.size = size.value_or(options.generator->size);
+        options.parameters.rows = rows.value_or(options.generator->rows);
+        if (options.parameters.size == 0) {
+            throw std::invalid_argument("size must be positive");
+        }
+
+        return options;
+    }
+}  // namespace
+
+
+int main(int argc, char** argv) {
+    std::optional<Options> options;
+    try {
+        options = parse_options(argc, argv);
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << std::endl;
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (options->list) {
+        print_list();
+        return EXIT_SUCCESS;
+    }
+
+    std::ofstream file;
+    if (options->output) {
+        file.open(*options->output, std::ios::binary);
+        if (!file) {
+            std::cerr << "unable to open '" << options->output->string() << "'" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    {
+        auto& stream = options->output ? static_cast<std::ostream&>(file) : std::cout;
+        generator::Random random(options->parameters.seed);
+        generator::Writer writer(stream);
+        options->generator->generate(options->parameters, random, writer);
+    }
+
+    if (options->output) {
+        file.close();
+    }
+    if (!(options->output ? static_cast<bool>(file) : static_cast<bool>(std::cout))) {
+        std::cerr << "failed to write the generated input" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <vector>
+
+#include <common/puzzle.hpp>
+
+
+namespace year2023 {
+    // Every day of the year, ordered by day number.
+    [[nodiscard]] const std::vector<aoc::Puzzle>& puzzles();
+
+    // Looks a day up by its number; returns nullptr for unknown days.
+    [[nodiscard]] const aoc::Puzzle* find_puzzle(unsigned day);
+}  // namespace year2023
@@ -0,0 +1,71 @@
+#include <puzzles/puzzles.hpp>
+
+#include <algorithm>
+
+
+namespace year2023 {
+    aoc::Puzzle trebuchet();
+    aoc::Puzzle cube_conundrum();
+    aoc::Puzzle gear_ratios();
+    aoc::Puzzle scratchcards();
+    aoc::Puzzle garden_calculator();
+    aoc::Puzzle wait_for_it();
+    aoc::Puzzle camel_cards();
+    aoc::Puzzle haunted_wasteland();
+    aoc::Puzzle mirage_maintenance();
+    aoc::Puzzle pipe_maze();
+    aoc::Puzzle cosmic_expansion();
+    aoc::Puzzle hot_springs();
+    aoc::Puzzle point_of_incidence();
+    aoc::Puzzle parabolic_reflector_dish();
+    aoc::Puzzle lens_library();
+    aoc::Puzzle lava_floor();
+    aoc::Puzzle clumsy_crucible();
+    aoc::Puzzle lavaduct_lagoon();
+    aoc::Puzzle aplenty();
+    aoc::Puzzle pulse_propagation();
+    aoc::Puzzle step_counter();
+    aoc::Puzzle sand_slabs();
+    aoc::Puzzle long_walk();
+    aoc::Puzzle never_tell_me_the_odds();
+    aoc::Puzzle snowverload();
+
+    const std::vector<aoc::Puzzle>& puzzles() {
+        static const std::vector<aoc::Puzzle> all{
+            trebuchet(),
+            cube_conundrum(),
+            gear_ratios(),
+            scratchcards(),
+            garden_calculator(),
+            wait_for_it(),
+            camel_cards(),
+            haunted_wasteland(),
+            mirage_maintenance(),
+            pipe_maze(),
+            cosmic_expansion(),
+            hot_springs(),
+            point_of_incidence(),
+            parabolic_reflector_dish(),
+            lens_library(),
+            lava_floor(),
+            clumsy_crucible(),
+            lavaduct_lagoon(),
+            aplenty(),
+            pulse_propagation(),
+            step_counter(),
+            sand_slabs(),
+            long_walk(),
+            never_tell_me_the_odds(),
+            snowverload(),
+        };
+        return all;
+    }
+
+    const aoc::Puzzle* find_puzzle(unsigned day) {
+        const auto& all = puzzles();
+        const auto it = std::find_if(all.cbegin(), all.cend(), [day](const aoc::Puzzle& puzzle) {
+            return puzzle.day == day;
+        });
+        return it != all.cend() ? &*it : nullptr;
+    }
+}  // namespace year2023
@@ -0,0 +1,309 @@
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <exception>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <common/io.hpp>
+#include <common/json.hpp>
+#include <common/stats.hpp>
+
+
+namespace {
+    enum class Command { RECORD, CHECK, COMPARE };
+
+    // The phases every aoc-bench result reports, in the order of the per-phase thresholds.
+    constexpr std::array<std::string_view, 3> Phases{"parse", "solve", "total"};
+
+    struct Options {
+        Command command = Command::CHECK;
+        std::filesystem::path store = AOC_REGRESS_DIR;
+        std::optional<std::string> label;
+        std::string against = "baseline";
+        std::array<double, Phases.size()> thresholds{5, 5, 5};  // slowdown of the median in percent
+        double alpha = 0.01;
+        std::vector<std::string> bench_args;
+        std::vector<std::filesystem::path> reports;  // the two reports of `compare`
+    };
+
+    void print_usage(std::string_view program) {
+        std::cerr << "usage: " << program << " record [options] [-- <aoc-bench options>]\n"
+                  << "       " << program << " check [options] [-- <aoc-bench options>]\n"
+                  << "       " << program << " compare [options] <baseline.json> <current.json>\n"
+                  << "  record       run the benchmark suite, save the run and make it the baseline\n"
+                  << "  check        run the suite, save the run and compare it with the baseline\n"
+                  << "  compare      compare two aoc-bench reports\n"
+                  << "  --store      directory of the saved runs (default: " << AOC_REGRESS_DIR << ")\n"
+                  << "  --label      name to save the run under, e.g. a commit hash (default: the UTC time)\n"
+                  << "  --against    saved run that `check` compares with (default: the baseline)\n"
+                  << "  --threshold  [parse=|solve=|total=]<percent>: median slowdown that counts as a regression"
+                  << " (default: 5 for every phase)\n"
+                  << "  --alpha      significance level of the Mann-Whitney test on the runs (default: 0.01)\n"
+                  << "Exits with status 1 when a phase regressed, a day broke or its answer changed." << std::endl;
+    }
+
+    void parse_threshold(std::string_view value, Options& options) {
+        std::optional<std::size_t> phase;
+        if (const auto equals = value.find('='); equals != std::string_view::npos) {
+            const auto name = value.substr(0, equals);
+            for (std::size_t i = 0; i != Phases.size(); i++) {
+                if (Phases[i] == name) {
+                    phase = i;
+                }
+            }
+            if (!phase) {
+                throw std::invalid_argument("unknown phase '" + std::string(name) + "'");
+            }
+            value.remove_prefix(equals + 1);
+        }
+
+        const auto percent = std::stod(std::string(value));
+        if (phase) {
+            options.thresholds[*phase] = percent;
+        } else {
+            options.thresholds.fill(percent);
+        }
+    }
+
+    Options parse_options(int argc, char** argv) {
+        Options options;
+
+        const std::vector<std::string_view> args(argv + 1, argv + argc);
+        if (args.empty()) {
+            throw std::invalid_argument("no command given");
+        }
+        if (args[0] == "record") {
+            options.command = Command::RECORD;
+        } else if (args[0] == "check") {
+            options.command = Command::CHECK;
+        } else if (args[0] == "compare") {
+            options.command = Command::COMPARE;
+        } else {
+            throw std::invalid_argument("unknown command '" + std::string(args[0]) + "'");
+        }
+
+        const auto next_value = [&args](std::size_t& i) {
+            if (i + 1 == args.size()) {
+                throw std::invalid_argument("missing value for '" + std::string(args[i]) + "'");
+            }
+            return args[++i];
+        };
+
+        for (std::size_t i = 1; i != args.size(); i++) {
+            const auto arg = args[i];
+            if (arg == "--store") {
+                options.store = next_value(i);
+            } else if (arg == "--label") {
+                options.label = next_value(i);
+            } else if (arg == "--against") {
+                options.against = next_value(i);
+            } else if (arg == "--threshold") {
+                parse_threshold(next_value(i), options);
+            } else if (arg == "--alpha") {
+                options.alpha = std::stod(std::string(next_value(i)));
+            } else if (arg == "--" && options.command != Command::COMPARE) {
+                options.bench_args.assign(args.begin() + static_cast<std::ptrdiff_t>(i) + 1, args.end());
+                break;
+            } else if (options.command == Command::COMPARE && !arg.starts_with("--")) {
+                options.reports.emplace_back(arg);
+            } else {
+                throw std::invalid_argument("unexpected argument '" + std::string(arg) + "'");
+            }
+        }
+
+        if (options.command == Command::COMPARE && options.reports.size() != 2) {
+            throw std::invalid_argument("compare needs a baseline and a current report");
+        }
+
+        return options;
+    }
+
+    std::string utc_label() {
+        const auto now = std::time(nullptr);
+        std::array<char, 32> buffer{};
+        std::strftime(buffer.data(), buffer.size(), "%Y%m%dT%H%M%SZ", std::gmtime(&now));
+        return buffer.data();
+    }
+
+    // Quotes for std::system, which goes through the POSIX shell.
+    std::string quote(std::string_view argument) {
+        std::string quoted = "\"";
+        for (const char symbol : argument) {
+            if (symbol == '"' || symbol == '\\' || symbol == '$' || symbol == '`') {
+                quoted += '\\';
+            }
+            quoted += symbol;
+        }
+        return quoted + '"';
+    }
+
+    // Runs the aoc-bench of this build tree, which writes its report to `output`.
+    void run_suite(const Options& options, const std::filesystem::path& output) {
+        std::string command = quote(AOC_BENCH);
+        for (const auto& arg : options.bench_args) {
+            command += ' ' + quote(arg);
+        }
+        command += " --output " + quote(output.string());
+
+        std::filesystem::create_directories(output.parent_path());
+        if (std::system(command.c_str()) != 0) {
+            throw std::runtime_error("aoc-bench failed");
+        }
+    }
+
+    core::JsonValue load_report(const std::filesystem::path& path) {
+        const io::MappedFile file(path);
+        try {
+            return core::JsonValue::parse(file.view());
+        } catch (const std::invalid_argument& error) {
+            throw std::invalid_argument(path.string() + ": " + error.what());
+        }
+    }
+
+    std::vector<double> samples(const core::JsonValue& phase) {
+        const auto* const values = phase.find("samples_ns");
+        if (values == nullptr) {
+            throw std::invalid_argument("the report has no per-run samples, record it again with this aoc-bench");
+        }
+
+        std::vector<double> result;
+        for (const auto& value : values->items()) {
+            result.push_back(value.as_number());
+        }
+        return result;
+    }
+
+    const core::JsonValue* find_result(const core::JsonValue& report, unsigned day, double part) {
+        for (const auto& result : report.at("results").items()) {
+            if (result.at("day").as_number() == day && result.at("part").as_number() == part) {
+                return &result;
+            }
+        }
+        return nullptr;
+    }
+
+    // Prints a row per day and phase of `current`; returns the number of failures.
+    std::size_t compare(const Options& options, const core::JsonValue& baseline, const core::JsonValue& current) {
+        constexpr double NsPerMs = 1e6;
+
+        std::size_t failures = 0;
+        std::cout << std::fixed << std::setprecision(3);
+        std::cout << std::setw(4) << "day" << "  " << std::left << std::setw(24) << "puzzle" << std::setw(7) << "phase"
+                  << std::right << std::setw(12) << "base ms" << std::setw(12) << "now ms" << std::setw(10) << "change"
+                  << std::setw(10) << "p" << "  verdict\n";
+
+        for (const auto& result : current.at("results").items()) {
+            const auto day = static_cast<unsigned>(result.at("day").as_number());
+            const auto& name = result.at("name").as_string();
+            const auto print_note = [day, &name](std::string_view note) {
+                std::cout << std::setw(4) << day << "  " << std::left << std::setw(24) << name << std::right << note
+                          << '\n';
+            };
+
+            const auto* const base = find_result(baseline, day, result.at("part").as_number());
+            if (base == nullptr) {
+                print_note("not in the baseline");
+                continue;
+            }
+            if (const auto* const error = result.find("error")) {
+                print_note("error: " + error->as_string());
+                failures += base->find("error") == nullptr;
+                continue;
+            }
+            if (base->find("error") != nullptr) {
+                print_note("fixed since the baseline");
+                continue;
+            }
+            if (base->at("input_bytes").as_unsigned() != result.at("input_bytes").as_unsigned()) {
+                print_note("input changed, not comparable");
+                continue;
+            }
+            if (base->at("answer").as_unsigned() != result.at("answer").as_unsigned()) {
+                print_note("ANSWER CHANGED");
+                failures++;
+            }
+
+            for (std::size_t i = 0; i != Phases.size(); i++) {
+                const auto before = samples(base->at("phases").at(Phases[i]));
+                const auto after = samples(result.at("phases").at(Phases[i]));
+                const auto before_median = core::summarize(before).median;
+                const auto after_median = core::summarize(after).median;
+                const auto change = before_median > 0 ? (after_median / before_median - 1) * 100 : 0;
+                const auto test = core::mann_whitney(after, before);
+
+                std::string_view verdict;
+                double p = test.p_greater;
+                if (change > options.thresholds[i] && test.p_greater < options.alpha) {
+                    verdict = "REGRESSION";
+                    failures++;
+                } else if (change < -options.thresholds[i] && test.p_less < options.alpha) {
+                    verdict = "faster";
+                    p = test.p_less;
+                } else if (change < 0) {
+                    p = test.p_less;
+                }
+
+                std::cout << std::setw(4) << day << "  " << std::left << std::setw(24) << name << std::setw(7)
+                          << Phases[i] << std::right << std::setw(12) << before_median / NsPerMs << std::setw(12)
+                          << after_median / NsPerMs << std::setw(9) << std::showpos << std::setprecision(1) << change
+                          << std::noshowpos << '%' << std::setw(10) << std::setprecision(4) << p
+                          << std::setprecision(3) << "  " << verdict << '\n';
+            }
+        }
+
+        std::cout << failures << (failures == 1 ? " failure" : " failures") << " at alpha " << options.alpha
+                  << std::endl;
+        return failures;
+    }
+}  // namespace
+
+
+int main(int argc, char** argv) {
+    Options options;
+    try {
+        options = parse_options(argc, argv);
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << std::endl;
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    try {
+        if (options.command == Command::COMPARE) {
+            const auto baseline = load_report(options.reports[0]);
+            const auto current = load_report(options.reports[1]);
+            return compare(options, baseline, current) == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+
+        const auto runs = options.store / "runs";
+        const auto label = options.label.value_or(utc_label());
+        const auto run = runs / (label + ".json");
+        const auto baseline = options.store / "baseline.json";
+
+        if (options.command == Command::RECORD) {
+            run_suite(options, run);
+            std::filesystem::copy_file(run, baseline, std::filesystem::copy_options::overwrite_existing);
+            std::cout << "baseline is now " << label << " (" << run.string() << ")" << std::endl;
+            return EXIT_SUCCESS;
+        }
+
+        const auto reference = options.against == "baseline" ? baseline : runs / (options.against + ".json");
+        if (!std::filesystem::exists(reference)) {
+            throw std::invalid_argument("no saved run at " + reference.string() + ", record one first");
+        }
+        run_suite(options, run);
+        std::cout << "saved as " << label << " (" << run.string() << ")\n";
+        return compare(options, load_report(reference), load_report(run)) == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+}
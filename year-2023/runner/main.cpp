@@ -0,0 +1,228 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <common/cache.hpp>
+#include <common/io.hpp>
+#include <common/puzzle.hpp>
+#include <common/thread_pool.hpp>
+#include <common/timing.hpp>
+#include <puzzles/puzzles.hpp>
+
+
+namespace {
+    struct Options {
+        std::filesystem::path inputs = AOC_INPUTS_DIR;
+        std::optional<std::filesystem::path> input;  // "-" reads stdin
+        bool stream = false;
+        bool cache = true;
+        std::size_t threads = std::thread::hardware_concurrency();
+        std::vector<const aoc::Puzzle*> puzzles;
+    };
+
+    struct Report {
+        const aoc::Puzzle* puzzle = nullptr;
+        std::optional<aoc::Answer> answer;
+        std::string error;
+        bool unsolved = false;  // the day does not implement the part yet, which is not a failure
+        std::chrono::nanoseconds wall{};
+        std::chrono::nanoseconds cpu{};
+    };
+
+    void print_usage(std::string_view program) {
+        std::cerr << "usage: " << program
+                  << " [--inputs <dir>] [--input <file>|-] [--stream] [--no-cache] [--threads <count>] [day...]\n"
+                  << "  --inputs   directory holding the day-N/input.txt files (default: " << AOC_INPUTS_DIR << ")\n"
+                  << "  --input    explicit input file, '-' for stdin (implies --stream); needs a single day\n"
+                  << "  --stream   read the input in fixed-size chunks where the day supports it, in bounded memory\n"
+                  << "  --no-cache solve every day even when its answer for this input is in the result cache\n"
+                  << "  --threads  worker threads (default: hardware concurrency)\n"
+                  << "  day        day numbers to run (default: every registered day that finishes)\n"
+                  << "  --help     print this message" << std::endl;
+    }
+
+    // A day number; anything else is reported as an unknown day rather than as a failed conversion.
+    unsigned to_day(std::string_view arg) {
+        try {
+            auto value = arg;
+            return io::read<unsigned>(value);
+        } catch (const std::invalid_argument&) {
+            throw std::invalid_argument("unknown day '" + std::string(arg) + "'");
+        }
+    }
+
+    // Nothing when --help was asked for.
+    std::optional<Options> parse_options(int argc, char** argv) {
+        Options options;
+
+        const std::vector<std::string_view> args(argv + 1, argv + argc);
+        for (std::size_t i = 0; i != args.size(); i++) {
+            const auto arg = args[i];
+            if (arg == "--help" || arg == "-h") {
+                return std::nullopt;
+            } else if (arg == "--inputs" && i + 1 != args.size()) {
+                options.inputs = args[++i];
+            } else if (arg == "--input" && i + 1 != args.size()) {
+                options.input = args[++i];
+            } else if (arg == "--stream") {
+                options.stream = true;
+            } else if (arg == "--no-cache") {
+                options.cache = false;
+            } else if (arg == "--threads" && i + 1 != args.size()) {
+                auto value = args[++i];
+                options.threads = io::read<std::size_t>(value);
+            } else if (arg.starts_with("-")) {
+                throw std::invalid_argument("unexpected argument '" + std::string(arg) + "'");
+            } else {
+                const auto* puzzle = year2023::find_puzzle(to_day(arg));
+                if (puzzle == nullptr) {
+                    throw std::invalid_argument("unknown day '" + std::string(arg) + "'");
+                }
+                options.puzzles.push_back(puzzle);
+            }
+        }
+
+        if (options.input && options.puzzles.size() != 1) {
+            throw std::invalid_argument("--input needs exactly one day");
+        }
+        if (options.input == "-") {
+            options.stream = true;
+        }
+
+        // a day that never finishes would hold up the whole run, it only runs when asked for by number
+        if (options.puzzles.empty()) {
+            for (const auto& puzzle : year2023::puzzles()) {
+                if (!puzzle.slow) {
+                    options.puzzles.push_back(&puzzle);
+                }
+            }
+        }
+
+        return options;
+    }
+
+    void run(const Options& options, Report& report) {
+        const auto wall_start = std::chrono::steady_clock::now();
+        const auto cpu_start = core::thread_cpu_time();
+
+        try {
+            const auto& puzzle = *report.puzzle;
+            const auto path = options.input.value_or(
+                options.inputs / ("day-" + std::to_string(puzzle.day)) / "input.txt"
+            );
+            const bool from_stdin = path == "-";
+
+            const auto solution = puzzle.create();
+            auto* const streaming = options.stream ? dynamic_cast<aoc::StreamingSolution*>(solution.get()) : nullptr;
+            if (streaming != nullptr) {
+                std::optional<io::StreamReader> input;
+                if (from_stdin) {
+                    input.emplace(stdin);
+                } else {
+                    input.emplace(path);
+                }
+                report.answer = streaming->solve_stream(*input, puzzle.part);
+            } else if (from_stdin) {
+                throw std::invalid_argument("this day cannot be streamed from stdin");
+            } else {
+                // days without a streaming reduction need the whole input at once
+                const io::MappedFile document(path);
+
+                std::optional<aoc::ResultCache> cache;
+                std::optional<aoc::ResultCache::Key> key;
+                if (options.cache) {
+                    key = aoc::ResultCache::make_key(puzzle, puzzle.part, document.view());
+                    if (key) {
+                        cache.emplace();
+                        report.answer = cache->find(*key);
+                    }
+                }
+
+                if (!report.answer) {
+                    solution->parse(document.view());
+                    report.answer = solution->solve(puzzle.part);
+                    if (cache) {
+                        cache->store(*key, *report.answer);
+                    }
+                }
+            }
+        } catch (const aoc::UnsolvedPart& error) {
+            report.error = error.what();
+            report.unsolved = true;
+        } catch (const std::exception& error) {
+            report.error = error.what();
+        }
+
+        report.cpu = core::thread_cpu_time() - cpu_start;
+        report.wall = std::chrono::steady_clock::now() - wall_start;
+    }
+
+    double to_ms(std::chrono::nanoseconds duration) {
+        return std::chrono::duration<double, std::milli>(duration).count();
+    }
+}  // namespace
+
+
+int main(int argc, char** argv) {
+    std::optional<Options> options;
+    try {
+        options = parse_options(argc, argv);
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << std::endl;
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (!options) {
+        print_usage(argv[0]);
+        return EXIT_SUCCESS;
+    }
+
+    std::vector<Report> reports(options->puzzles.size());
+    for (std::size_t i = 0; i != reports.size(); i++) {
+        reports[i].puzzle = options->puzzles[i];
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    {
+        core::ThreadPool pool(options->threads);
+        for (auto& report : reports) {
+            pool.submit([&options = *options, &report]() { run(options, report); });
+        }
+        pool.wait();
+    }
+    const auto makespan = std::chrono::steady_clock::now() - start;
+
+    bool failed = false;
+    std::chrono::nanoseconds total_cpu{};
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << std::setw(4) << "day" << "  " << std::left << std::setw(24) << "puzzle" << std::setw(20) << "answer"
+              << std::right << std::setw(12) << "wall ms" << std::setw(12) << "cpu ms" << '\n';
+    for (const auto& report : reports) {
+        const auto answer = report.answer ? std::to_string(*report.answer)
+                          : report.unsolved ? std::string("unsolved")
+                                            : "error: " + report.error;
+        std::cout << std::setw(4) << report.puzzle->day << "  " << std::left << std::setw(24) << report.puzzle->name
+                  << std::setw(20) << answer << std::right << std::setw(12) << to_ms(report.wall) << std::setw(12)
+                  << to_ms(report.cpu) << '\n';
+
+        failed = failed || (!report.answer && !report.unsolved);
+        total_cpu += report.cpu;
+    }
+    std::cout << "makespan " << to_ms(makespan) << " ms, cpu " << to_ms(total_cpu) << " ms on "
+              << std::max<std::size_t>(options->threads, 1) << " threads" << std::endl;
+
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}